@@ -0,0 +1,311 @@
+#ifndef PROJECT_1_BITMAPUNIVERSESET_HPP
+#define PROJECT_1_BITMAPUNIVERSESET_HPP
+
+#include "Utilities.hpp"
+
+#include <bit>
+#include <memory>
+#include <optional>
+
+#define BITMAP_CHUNK_BIT_SIZE 16 // A chunk covers the keys sharing their top 16 bits.
+
+
+/*
+ * Ordered set of 32-bit keys as bitmaps over the whole universe. The top 16 bits of a key pick a
+ * chunk, and the chunk holds the low 16 bits in a 3-level 64-ary bitmap: 1024 leaf words, 16 words
+ * marking the non-empty leaf words and 1 word marking the non-empty ones of those. A summary
+ * bitmap of the same shape marks the non-empty chunks, and chunks are only allocated once a key
+ * falls into them, so a dense key range costs about one bit per slot of the range rather than
+ * the 512 MiB of a flat bitmap.
+ *
+ * Membership is one bit test. Successor and predecessor go up at most 3 levels within the chunk,
+ * then up to 3 in the summary and down the next chunk, every step being one 'tzcnt' or 'lzcnt'.
+ */
+template <typename key_type, typename array_type>
+class BitmapUniverseSet
+{
+private:
+    static_assert(sizeof(key_type) * CHAR_BIT == 2 * BITMAP_CHUNK_BIT_SIZE, "BitmapUniverseSet covers 32-bit keys.");
+
+    // 3-level 64-ary bitmap over 2^16 positions.
+    struct bitmap_type
+    {
+        uint64_t top = 0;          // Bit i set if mid[i] is non-zero.
+        uint64_t mid[16] = {};     // Bit j of mid[i] set if leaves[64 i + j] is non-zero.
+        uint64_t leaves[1024] = {};
+
+        static uint64_t from(const uint64_t& word, const unsigned int& bit)
+        {
+            return word & (~0ull << bit);                       // Bits bit, ..., 63.
+        }
+        static uint64_t after(const uint64_t& word, const unsigned int& bit)
+        {
+            return bit >= 63 ? 0 : word & (~0ull << (bit + 1)); // Bits bit + 1, ..., 63.
+        }
+        static uint64_t up_to(const uint64_t& word, const unsigned int& bit)
+        {
+            return bit >= 63 ? word : word & ((2ull << bit) - 1); // Bits 0, ..., bit.
+        }
+        static uint64_t before(const uint64_t& word, const unsigned int& bit)
+        {
+            return word & ((1ull << bit) - 1);                    // Bits 0, ..., bit - 1.
+        }
+        static unsigned int highest(const uint64_t& word)
+        {
+            return 63 - std::countl_zero(word);
+        }
+
+        bool empty() const
+        {
+            return this->top == 0;
+        }
+
+        bool contains(const uint32_t& x) const
+        {
+            return (this->leaves[x >> 6] >> (x & 63)) & 1;
+        }
+
+        bool insert(const uint32_t& x)
+        {
+            const uint64_t bit = 1ull << (x & 63);
+            if(this->leaves[x >> 6] & bit) return false;
+            this->leaves[x >> 6] |= bit;
+            this->mid[x >> 12] |= 1ull << ((x >> 6) & 63);
+            this->top |= 1ull << (x >> 12);
+            return true;
+        }
+
+        bool remove(const uint32_t& x)
+        {
+            const uint64_t bit = 1ull << (x & 63);
+            if(!(this->leaves[x >> 6] & bit)) return false;
+            if((this->leaves[x >> 6] &= ~bit) == 0)
+            {
+                if((this->mid[x >> 12] &= ~(1ull << ((x >> 6) & 63))) == 0) this->top &= ~(1ull << (x >> 12));
+            }
+            return true;
+        }
+
+        uint32_t min() const
+        {
+            const uint32_t i = std::countr_zero(this->top);
+            const uint32_t w = (i << 6) | std::countr_zero(this->mid[i]);
+            return (w << 6) | std::countr_zero(this->leaves[w]);
+        }
+
+        uint32_t max() const
+        {
+            const uint32_t i = highest(this->top);
+            const uint32_t w = (i << 6) | highest(this->mid[i]);
+            return (w << 6) | highest(this->leaves[w]);
+        }
+
+        std::optional<uint32_t> first_from(const uint32_t& x) const
+        {
+            /*
+             * Smallest position >= x. The leaf word of x first, then the next non-empty word
+             * below the same mid word, then the next non-empty mid word.
+             * */
+            const uint32_t w = x >> 6, i = x >> 12;
+            uint64_t word = from(this->leaves[w], x & 63);
+            if(word != 0) return (w << 6) | std::countr_zero(word);
+            word = after(this->mid[i], w & 63);
+            if(word != 0)
+            {
+                const uint32_t next_w = (i << 6) | std::countr_zero(word);
+                return (next_w << 6) | std::countr_zero(this->leaves[next_w]);
+            }
+            word = after(this->top, i);
+            if(word == 0) return std::nullopt;
+            const uint32_t next_i = std::countr_zero(word);
+            const uint32_t next_w = (next_i << 6) | std::countr_zero(this->mid[next_i]);
+            return (next_w << 6) | std::countr_zero(this->leaves[next_w]);
+        }
+
+        std::optional<uint32_t> last_up_to(const uint32_t& x) const
+        {
+            /*
+             * Largest position <= x, mirroring 'first_from'.
+             * */
+            const uint32_t w = x >> 6, i = x >> 12;
+            uint64_t word = up_to(this->leaves[w], x & 63);
+            if(word != 0) return (w << 6) | highest(word);
+            word = before(this->mid[i], w & 63);
+            if(word != 0)
+            {
+                const uint32_t previous_w = (i << 6) | highest(word);
+                return (previous_w << 6) | highest(this->leaves[previous_w]);
+            }
+            word = before(this->top, i);
+            if(word == 0) return std::nullopt;
+            const uint32_t previous_i = highest(word);
+            const uint32_t previous_w = (previous_i << 6) | highest(this->mid[previous_i]);
+            return (previous_w << 6) | highest(this->leaves[previous_w]);
+        }
+    };
+
+    static constexpr uint32_t low_mask = (1u << BITMAP_CHUNK_BIT_SIZE) - 1;
+
+    // Attributes
+    uint64_t nr_keys, nr_chunks;
+    bitmap_type summary;                               // Marks the non-empty chunks.
+    std::vector<std::unique_ptr<bitmap_type>> chunks;  // 2^16 chunks, only the non-empty ones allocated.
+
+public:
+
+    class iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = key_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const key_type*;
+        using reference = const key_type&;
+
+        iterator() = default;
+        iterator(const BitmapUniverseSet* set, const std::optional<key_type>& key) : set(set), key(key) {}
+
+        reference operator*() const { return *this->key; }
+        pointer operator->() const { return &*this->key; }
+
+        iterator& operator++()
+        {
+            this->key = this->set->successor(*this->key);
+            return *this;
+        }
+        iterator operator++(int)
+        {
+            iterator previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        bool operator==(const iterator& other) const { return this->key == other.key; }
+
+    private:
+        const BitmapUniverseSet* set = nullptr;
+        std::optional<key_type> key; // Empty at the end.
+    };
+
+    // Standard un-parametrized C-tor.
+    BitmapUniverseSet() : nr_keys(0), nr_chunks(0), chunks(1ull << BITMAP_CHUNK_BIT_SIZE) {}
+
+    // Methods
+    void insert(const key_type& key)
+    {
+        std::unique_ptr<bitmap_type>& chunk = this->chunks[key >> BITMAP_CHUNK_BIT_SIZE];
+        if(!chunk)
+        {
+            chunk = std::make_unique<bitmap_type>();
+            this->summary.insert(key >> BITMAP_CHUNK_BIT_SIZE);
+            this->nr_chunks++;
+        }
+        this->nr_keys += chunk->insert(key & low_mask);
+    }
+
+    void insert_keys(const array_type& keys)
+    {
+        for(key_type key : keys) insert(key);
+    }
+
+    bool remove(const key_type& key)
+    {
+        /*
+         * Removes the key (if present). A chunk left empty is freed.
+         */
+        std::unique_ptr<bitmap_type>& chunk = this->chunks[key >> BITMAP_CHUNK_BIT_SIZE];
+        if(!chunk || !chunk->remove(key & low_mask)) return false;
+        this->nr_keys--;
+        if(chunk->empty())
+        {
+            chunk.reset();
+            this->summary.remove(key >> BITMAP_CHUNK_BIT_SIZE);
+            this->nr_chunks--;
+        }
+        return true;
+    }
+
+    bool holds(const key_type& key) const
+    {
+        const bitmap_type* chunk = this->chunks[key >> BITMAP_CHUNK_BIT_SIZE].get();
+        return chunk != nullptr && chunk->contains(key & low_mask);
+    }
+
+    std::optional<key_type> first_from(const key_type& key) const
+    {
+        /*
+         * Smallest key >= 'key', if any.
+         */
+        const uint32_t high = key >> BITMAP_CHUNK_BIT_SIZE;
+        if(const bitmap_type* chunk = this->chunks[high].get())
+        {
+            if(std::optional<uint32_t> low = chunk->first_from(key & low_mask)) return (high << BITMAP_CHUNK_BIT_SIZE) | *low;
+        }
+        if(high == low_mask) return std::nullopt;
+        std::optional<uint32_t> next_high = this->summary.first_from(high + 1);
+        if(!next_high) return std::nullopt;
+        return (*next_high << BITMAP_CHUNK_BIT_SIZE) | this->chunks[*next_high]->min();
+    }
+
+    std::optional<key_type> last_up_to(const key_type& key) const
+    {
+        /*
+         * Largest key <= 'key', if any.
+         */
+        const uint32_t high = key >> BITMAP_CHUNK_BIT_SIZE;
+        if(const bitmap_type* chunk = this->chunks[high].get())
+        {
+            if(std::optional<uint32_t> low = chunk->last_up_to(key & low_mask)) return (high << BITMAP_CHUNK_BIT_SIZE) | *low;
+        }
+        if(high == 0) return std::nullopt;
+        std::optional<uint32_t> previous_high = this->summary.last_up_to(high - 1);
+        if(!previous_high) return std::nullopt;
+        return (*previous_high << BITMAP_CHUNK_BIT_SIZE) | this->chunks[*previous_high]->max();
+    }
+
+    std::optional<key_type> successor(const key_type& key) const
+    {
+        /*
+         * Smallest key > 'key', if any.
+         */
+        if(key == std::numeric_limits<key_type>::max()) return std::nullopt;
+        return first_from(key + 1);
+    }
+
+    std::optional<key_type> predecessor(const key_type& key) const
+    {
+        /*
+         * Largest key < 'key', if any.
+         */
+        if(key == 0) return std::nullopt;
+        return last_up_to(key - 1);
+    }
+
+    iterator lower_bound(const key_type& key) const
+    {
+        return iterator(this, first_from(key));
+    }
+
+    iterator begin() const
+    {
+        return lower_bound(0);
+    }
+
+    iterator end() const
+    {
+        return iterator(this, std::nullopt);
+    }
+
+    uint64_t size() const
+    {
+        return this->nr_keys;
+    }
+
+    uint64_t size_in_bytes() const
+    {
+        return sizeof(*this) + this->chunks.capacity() * sizeof(std::unique_ptr<bitmap_type>) + this->nr_chunks * sizeof(bitmap_type);
+    }
+
+};
+
+#endif //PROJECT_1_BITMAPUNIVERSESET_HPP
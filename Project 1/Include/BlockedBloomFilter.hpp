@@ -0,0 +1,157 @@
+#ifndef PROJECT_1_BLOCKEDBLOOMFILTER_HPP
+#define PROJECT_1_BLOCKEDBLOOMFILTER_HPP
+
+#include "Utilities.hpp"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#define BLOOM_BLOCK_NR_WORDS 8   // 8 words of 64 bits, i.e. one 512-bit cache line per block.
+#define BLOOM_BITS_PER_KEY 12
+
+
+/*
+ * Blocked Bloom filter. A multiply-shift hash picks one cache-line sized block per key, and the
+ * key sets one bit in each of the block's 8 words, the bit given by the top 6 bits of the key
+ * multiplied by a per-word odd constant. A query is thereby one memory access, and with AVX2 all
+ * 8 bit positions are computed and tested at once. False positives are somewhat more frequent than
+ * for an unblocked filter with the same number of bits. The number of blocks is rounded up to a
+ * power of two, so a filter gets between 'bits_per_key' and twice that many bits per key.
+ */
+template <typename key_type, typename array_type>
+class BlockedBloomFilter
+{
+private:
+    struct alignas(64) block_type
+    {
+        uint64_t words[BLOOM_BLOCK_NR_WORDS];
+    };
+
+    // Odd multipliers from the split block Bloom filter of Apache Parquet/Impala.
+    static constexpr uint32_t salts[BLOOM_BLOCK_NR_WORDS] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+                                                             0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+    // Attributes
+    unsigned int nr_blocks;
+
+    key_type a, l;
+
+
+    // Methods
+    block_type mask_of(const key_type& key) const
+    {
+        /*
+         * The 8 bits set by 'key', one per word.
+         * */
+        block_type mask;
+#if defined(__AVX2__)
+        __m256i products = _mm256_mullo_epi32(_mm256_set1_epi32((int)key), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(salts)));
+        __m256i positions = _mm256_srli_epi32(products, 32 - 6);
+        const __m256i one = _mm256_set1_epi64x(1);
+        _mm256_store_si256(reinterpret_cast<__m256i*>(mask.words), _mm256_sllv_epi64(one, _mm256_cvtepu32_epi64(_mm256_castsi256_si128(positions))));
+        _mm256_store_si256(reinterpret_cast<__m256i*>(mask.words + 4), _mm256_sllv_epi64(one, _mm256_cvtepu32_epi64(_mm256_extracti128_si256(positions, 1))));
+#else
+        for(unsigned int word = 0; word < BLOOM_BLOCK_NR_WORDS; word++)
+        {
+            mask.words[word] = 1ull << ((uint32_t)(key * salts[word]) >> (32 - 6));
+        }
+#endif
+        return mask;
+    }
+
+public:
+
+    // Attributes
+    std::vector<block_type> blocks;
+
+    // Parameterized C-tor
+    [[maybe_unused]] explicit BlockedBloomFilter(const unsigned int& n, const unsigned int& seed, const unsigned int& bits_per_key = BLOOM_BITS_PER_KEY)
+    {
+        this->nr_blocks = 2;
+        while((uint64_t)this->nr_blocks * sizeof(block_type) * CHAR_BIT < (uint64_t)n * bits_per_key) this->nr_blocks *= 2;
+        this->blocks.assign(this->nr_blocks, block_type{});
+        this->a = get_random_odd_uint32(seed);
+        this->l = std::log2(this->nr_blocks); // if m = 2^l then l = log2(m)
+    }
+
+    // Methods
+    void insert(const key_type& key)
+    {
+        block_type mask = mask_of(key);
+        block_type& block = this->blocks[hash(key, this->a, this->l)];
+        for(unsigned int word = 0; word < BLOOM_BLOCK_NR_WORDS; word++) block.words[word] |= mask.words[word];
+    }
+
+    void insert_keys(const array_type& keys)
+    {
+        for(key_type key : keys) insert(key);
+    }
+
+    bool may_contain(const key_type& key) const
+    {
+        /*
+         * False means that the key was never inserted, true that it probably was.
+         */
+        const block_type& block = this->blocks[hash(key, this->a, this->l)];
+        block_type mask = mask_of(key);
+#if defined(__AVX2__)
+        __m256i low = _mm256_load_si256(reinterpret_cast<const __m256i*>(block.words));
+        __m256i high = _mm256_load_si256(reinterpret_cast<const __m256i*>(block.words + 4));
+        __m256i mask_low = _mm256_load_si256(reinterpret_cast<const __m256i*>(mask.words));
+        __m256i mask_high = _mm256_load_si256(reinterpret_cast<const __m256i*>(mask.words + 4));
+        // testc is 1 if every bit of the mask is set in the block.
+        return _mm256_testc_si256(low, mask_low) && _mm256_testc_si256(high, mask_high);
+#else
+        uint64_t missing = 0;
+        for(unsigned int word = 0; word < BLOOM_BLOCK_NR_WORDS; word++) missing |= mask.words[word] & ~block.words[word];
+        return missing == 0;
+#endif
+    }
+
+    uint64_t size_in_bytes() const
+    {
+        return (uint64_t)this->nr_blocks * sizeof(block_type);
+    }
+
+};
+
+
+/*
+ * Puts a 'BlockedBloomFilter' in front of any table with 'holds' ('HashingWithChaining',
+ * 'PerfectHashing', 'RedBlackTree', ...), so that most queries for absent keys are answered
+ * without touching the table. The table is moved in already filled, together with its keys.
+ */
+template <typename key_type, typename array_type, typename table_type>
+class FrontFiltered
+{
+public:
+
+    // Attributes
+    table_type table;
+    BlockedBloomFilter<key_type, array_type> filter;
+
+    // Parameterized C-tor
+    [[maybe_unused]] explicit FrontFiltered(table_type&& table, const array_type& keys, const unsigned int& seed,
+                                            const unsigned int& bits_per_key = BLOOM_BITS_PER_KEY)
+        : table(std::move(table)), filter(keys.size(), seed, bits_per_key)
+    {
+        this->filter.insert_keys(keys);
+    }
+
+    // Methods
+    void insert(const key_type& key)
+    {
+        // Only for tables that support single insertions.
+        this->table.insert(key);
+        this->filter.insert(key);
+    }
+
+    bool holds(const key_type& key)
+    {
+        return this->filter.may_contain(key) && this->table.holds(key);
+    }
+
+};
+
+#endif //PROJECT_1_BLOCKEDBLOOMFILTER_HPP
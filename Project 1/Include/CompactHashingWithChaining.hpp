@@ -0,0 +1,180 @@
+#ifndef PROJECT_1_COMPACTHASHINGWITHCHAINING_HPP
+#define PROJECT_1_COMPACTHASHINGWITHCHAINING_HPP
+
+#include "Utilities.hpp"
+#include "CompactVector.hpp"
+#include "EliasFanoSet.hpp"
+
+#include <bit>
+
+
+/*
+ * Static hashing with chaining that stores only the quotient remainders of the keys. With 'hash'
+ * being (a key mod 2^32) >> (32 - l) for an odd a, the scrambled key x = a key mod 2^32 is a
+ * bijection of the key, and its top l bits are the bucket. A bucket therefore only has to hold the
+ * low 32 - l bits of x of every key in it, and 'holds' compares those directly. The keys are still
+ * recoverable, as x times the inverse of a mod 2^32.
+ *
+ * The chains are laid out back to back, bucket by bucket, in one compact vector of (32 - l)-bit
+ * remainders, i.e. 12 bits per key at n = 2^20 instead of 32. Where each bucket starts is the
+ * increasing sequence start(i) + i, which is Elias-Fano coded in about 3 bits per bucket.
+ *
+ * Built once by 'insert_keys', then only queried.
+ */
+template <typename key_type, typename array_type>
+class CompactHashingWithChaining
+{
+private:
+    // Attributes
+    unsigned int m, nr_keys;
+    key_type a, a_inverse, l;
+    CompactVector remainders;
+    EliasFanoSet<key_type, array_type> bucket_starts; // start(i) + i for the buckets i = 0, ..., m.
+
+
+    // Methods
+    void initialize_consts(const unsigned int& seed)
+    {
+        /*
+         * Initializing constants for hash function here
+         * to avoid continuous recalculation when
+         * calling hash function.
+         * */
+        this->a = get_random_odd_uint32(seed);
+        this->l = std::log2(this->m); // if m = 2^l then l = log2(m)
+
+        // Newton's iteration for the inverse of a mod 2^32. a a = 1 mod 8 as a is odd, and every
+        // step doubles the number of correct low bits, so 3 -> 6 -> 12 -> 24 -> 48.
+        this->a_inverse = this->a;
+        for(unsigned int step = 0; step < 4; step++) this->a_inverse *= 2 - this->a * this->a_inverse;
+    }
+
+    key_type remainder_mask() const
+    {
+        return (key_type)((1ull << (KEY_BIT_SIZE - this->l)) - 1);
+    }
+
+public:
+
+    // Parameterized C-tor
+    [[maybe_unused]] explicit CompactHashingWithChaining(const unsigned int& n, const unsigned int& seed)
+    {
+        this->m = std::max(std::bit_ceil(n), 2u); // l = 0 would make the hash function shift by 32.
+        this->nr_keys = 0;
+        initialize_consts(seed);
+        this->remainders = CompactVector(0, KEY_BIT_SIZE - this->l);
+        array_type bucket_starts(this->m + 1);
+        std::iota(bucket_starts.begin(), bucket_starts.end(), 0); // All buckets empty.
+        this->bucket_starts.insert_keys(bucket_starts);
+    }
+
+    // Methods
+    void insert_keys(const array_type& keys)
+    {
+        /*
+         * Rebuilds the table over its current keys plus 'keys', keeping a. The number of buckets
+         * is the number of keys rounded up to a power of 2.
+         */
+        array_type all_keys = stored_keys();
+        all_keys.insert(all_keys.end(), keys.begin(), keys.end());
+        std::sort(all_keys.begin(), all_keys.end());
+        all_keys.erase(std::unique(all_keys.begin(), all_keys.end()), all_keys.end());
+
+        this->nr_keys = all_keys.size();
+        this->m = std::max(std::bit_ceil(this->nr_keys), 2u);
+        this->l = std::log2(this->m);
+
+        // Counting sort of the keys by bucket.
+        std::vector<unsigned int> starts(this->m + 1, 0);
+        for(key_type key : all_keys) starts[hash(key, this->a, this->l) + 1]++;
+        std::partial_sum(starts.begin(), starts.end(), starts.begin());
+        std::vector<unsigned int> fill(starts.begin(), starts.end() - 1);
+        this->remainders = CompactVector(this->nr_keys, KEY_BIT_SIZE - this->l);
+        for(key_type key : all_keys)
+        {
+            const key_type scrambled_key = this->a * key;
+            this->remainders.set(fill[scrambled_key >> (KEY_BIT_SIZE - this->l)]++, scrambled_key & remainder_mask());
+        }
+
+        array_type bucket_starts(this->m + 1);
+        for(unsigned int i = 0; i <= this->m; i++) bucket_starts[i] = starts[i] + i;
+        this->bucket_starts = EliasFanoSet<key_type, array_type>();
+        this->bucket_starts.insert_keys(bucket_starts);
+    }
+
+    bool holds(const key_type& key) const
+    {
+        /*
+         * Checks whether the provided key is stored in the hash table, by comparing its remainder
+         * to the remainders of its bucket.
+         */
+        const key_type scrambled_key = this->a * key;
+        const key_type index = scrambled_key >> (KEY_BIT_SIZE - this->l), remainder = scrambled_key & remainder_mask();
+        auto iterator = this->bucket_starts.at(index);
+        const uint64_t start = *iterator - index;
+        const uint64_t end = *++iterator - (index + 1);
+        for(uint64_t i = start; i < end; i++)
+        {
+            if(this->remainders.get(i) == remainder) return true;
+        }
+        return false;
+    }
+
+    array_type stored_keys() const
+    {
+        /*
+         * All keys of the table, bucket by bucket, each recovered from its bucket and remainder.
+         */
+        array_type keys;
+        keys.reserve(this->nr_keys);
+        auto iterator = this->bucket_starts.begin();
+        for(key_type index = 0; index < this->m; index++)
+        {
+            const uint64_t start = *iterator - index;
+            const uint64_t end = *++iterator - (index + 1);
+            for(uint64_t i = start; i < end; i++)
+            {
+                const key_type scrambled_key = (index << (KEY_BIT_SIZE - this->l)) | (key_type)this->remainders.get(i);
+                keys.push_back(scrambled_key * this->a_inverse);
+            }
+        }
+        return keys;
+    }
+
+    unsigned int max_bucket_size() const
+    {
+        unsigned int max_size = 0, previous_start = 0;
+        auto iterator = this->bucket_starts.begin();
+        for(key_type index = 1; index <= this->m; index++)
+        {
+            const unsigned int start = *++iterator - index;
+            max_size = std::max(max_size, start - previous_start);
+            previous_start = start;
+        }
+        return max_size;
+    }
+
+    unsigned int remainder_bit_size() const
+    {
+        return KEY_BIT_SIZE - this->l;
+    }
+
+    double load_factor() const
+    {
+        return (double)this->nr_keys / this->m;
+    }
+
+    uint64_t size() const
+    {
+        return this->nr_keys;
+    }
+
+    uint64_t size_in_bytes() const
+    {
+        return sizeof(*this) + this->remainders.size_in_bytes() - sizeof(CompactVector)
+               + this->bucket_starts.size_in_bytes() - sizeof(EliasFanoSet<key_type, array_type>);
+    }
+
+};
+
+#endif //PROJECT_1_COMPACTHASHINGWITHCHAINING_HPP
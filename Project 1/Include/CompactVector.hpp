@@ -0,0 +1,81 @@
+#ifndef PROJECT_1_COMPACTVECTOR_HPP
+#define PROJECT_1_COMPACTVECTOR_HPP
+
+#include "Utilities.hpp"
+
+#include <bit>
+
+
+/*
+ * Fixed size array of unsigned integers stored with 'width' bits each, packed back to back in
+ * 64-bit words (an integer may straddle two words). For the small integers of the static
+ * structures, e.g. pilots and free slots of 'MinimalPerfectHashing'.
+ */
+class CompactVector
+{
+private:
+    // Attributes
+    uint64_t n;
+    unsigned int width;
+    uint64_t mask;
+    std::vector<uint64_t> words;
+
+public:
+
+    // Standard un-parametrized C-tor.
+    CompactVector() : n(0), width(0), mask(0) {}
+
+    // Parameterized C-tor
+    [[maybe_unused]] explicit CompactVector(const uint64_t& n, const unsigned int& width)
+    {
+        if(width > 64) throw std::runtime_error("Width given to CompactVector C-tor should be at most 64 bits.");
+        this->n = n;
+        this->width = width;
+        this->mask = width == 64 ? ~0ull : (1ull << width) - 1;
+        this->words.assign(n * width / 64 + 1, 0); // One word of slack, so that a read never needs a bounds check.
+    }
+
+    // Methods
+    static unsigned int width_of(const uint64_t& max_value)
+    {
+        // Bits needed for the values up to 'max_value', at least 1.
+        return std::max(1, (int)std::bit_width(max_value));
+    }
+
+    uint64_t get(const uint64_t& i) const
+    {
+        const uint64_t bit = i * this->width, word = bit / 64, shift = bit % 64;
+        uint64_t value = this->words[word] >> shift;
+        if(shift + this->width > 64) value |= this->words[word + 1] << (64 - shift);
+        return value & this->mask;
+    }
+
+    void set(const uint64_t& i, const uint64_t& value)
+    {
+        const uint64_t bit = i * this->width, word = bit / 64, shift = bit % 64;
+        this->words[word] = (this->words[word] & ~(this->mask << shift)) | ((value & this->mask) << shift);
+        if(shift + this->width > 64)
+        {
+            const uint64_t high_mask = this->mask >> (64 - shift);
+            this->words[word + 1] = (this->words[word + 1] & ~high_mask) | ((value & this->mask) >> (64 - shift));
+        }
+    }
+
+    uint64_t size() const
+    {
+        return this->n;
+    }
+
+    unsigned int bit_width() const
+    {
+        return this->width;
+    }
+
+    uint64_t size_in_bytes() const
+    {
+        return sizeof(*this) + this->words.capacity() * sizeof(uint64_t);
+    }
+
+};
+
+#endif //PROJECT_1_COMPACTVECTOR_HPP
@@ -0,0 +1,151 @@
+#ifndef PROJECT_1_CONCURRENTHASHINGWITHCHAINING_HPP
+#define PROJECT_1_CONCURRENTHASHINGWITHCHAINING_HPP
+
+#include "Utilities.hpp"
+
+#include <shared_mutex>
+#include <mutex>
+#include <array>
+
+#define CONCURRENT_HWC_STRIPE_BIT_SIZE 8
+
+
+template <typename key_type, typename array_type, typename list_type>
+class ConcurrentHashingWithChaining
+{
+private:
+    using hash_table_type = std::vector<list_type>;
+
+    // One lock per stripe, each on its own cache line so threads locking neighbouring stripes do not contend on the line.
+    struct alignas(64) stripe_type
+    {
+        std::shared_mutex mutex;
+    };
+
+    static constexpr unsigned int nr_stripes = 1u << CONCURRENT_HWC_STRIPE_BIT_SIZE;
+
+    // Attributes
+    std::atomic<unsigned int> m, nr_keys;
+
+    key_type a, l;
+
+    double max_load_factor;
+
+    std::array<stripe_type, nr_stripes> stripes;
+
+
+    // Methods
+    void initialize_consts(const unsigned int& seed)
+    {
+        /*
+         * Same constant as drawn by 'HashingWithChaining::initialize_consts' for the same seed.
+         * */
+
+        this->a = get_random_odd_uint32(seed);
+        this->l = std::log2(this->m.load()); // if m = 2^l then l = log2(m)
+    }
+
+    unsigned int stripe_of(const key_type& key)
+    {
+        /*
+         * The stripe is given by the top bits of the hash value, and the bucket by the top l bits.
+         * A stripe thereby guards a contiguous range of buckets, and as doubling the table only
+         * appends a bit to the bucket index, a key keeps its stripe when the table grows.
+         * */
+        return hash(key, this->a, CONCURRENT_HWC_STRIPE_BIT_SIZE);
+    }
+
+    void grow()
+    {
+        /*
+         * Doubles the number of buckets. All stripes are locked (always in the same order, so two
+         * growing threads cannot deadlock), which stops every other operation for the duration.
+         * */
+        std::vector<std::unique_lock<std::shared_mutex>> locks;
+        locks.reserve(nr_stripes);
+        for(stripe_type& stripe : this->stripes) locks.emplace_back(stripe.mutex);
+
+        // Another thread may have grown the table while this one was waiting for the locks.
+        if((double)this->nr_keys.load() <= this->max_load_factor * this->m.load()) return;
+
+        hash_table_type old_table = std::move(this->hash_table);
+        this->l++;
+        this->m = 1u << this->l;
+        this->hash_table = hash_table_type(this->m.load());
+        for(list_type& old_bucket : old_table)
+        {
+            while(!old_bucket.empty())
+            {
+                list_type& new_bucket = this->hash_table[hash(old_bucket.front(), this->a, this->l)];
+                new_bucket.splice(new_bucket.end(), old_bucket, old_bucket.begin());
+            }
+        }
+    }
+
+public:
+
+    // Attributes
+    hash_table_type hash_table;
+
+    // Parameterized C-tor
+    [[maybe_unused]] explicit ConcurrentHashingWithChaining(const unsigned int& n, const unsigned int& seed, const double& max_load_factor = 1.0)
+    {
+        if(max_load_factor <= 0.0) throw std::runtime_error("Max load factor given to ConcurrentHashingWithChaining C-tor should be positive.");
+        this->m = std::max(n, nr_stripes); // Every stripe must cover at least one whole bucket.
+        this->nr_keys = 0;
+        this->max_load_factor = max_load_factor;
+        this->hash_table = hash_table_type(this->m.load());
+        initialize_consts(seed);
+    }
+
+    // Methods
+    void insert(const key_type& key)
+    {
+        /*
+         * Safe to call from any number of threads at once. Only the stripe of the key is locked,
+         * exclusively, so writers to different stripes proceed in parallel.
+         */
+        {
+            std::unique_lock<std::shared_mutex> lock(this->stripes[stripe_of(key)].mutex);
+            this->hash_table[hash(key, this->a, this->l)].push_back(key);
+        }
+        if((double)(++this->nr_keys) > this->max_load_factor * this->m.load()) grow();
+    }
+
+    void insert_keys(const array_type& keys)
+    {
+        for(key_type key : keys) insert(key);
+    }
+
+    bool holds(const key_type& key)
+    {
+        /*
+         * Safe to call from any number of threads at once. The stripe is locked shared, so
+         * readers only wait for writers to the same stripe.
+         */
+        std::shared_lock<std::shared_mutex> lock(this->stripes[stripe_of(key)].mutex);
+        const list_type& bucket = this->hash_table[hash(key, this->a, this->l)];
+        return std::find(bucket.begin(), bucket.end(), key) != bucket.end();
+    }
+
+    unsigned int max_bucket_size()
+    {
+        /*
+         * Not synchronized, only call when no other thread modifies the table.
+         */
+        unsigned int max_size = 0;
+        for(const list_type& bucket : this->hash_table)
+        {
+            if(bucket.size() > max_size) max_size = bucket.size();
+        }
+        return max_size;
+    }
+
+    double load_factor()
+    {
+        return (double)this->nr_keys.load() / this->m.load();
+    }
+
+};
+
+#endif //PROJECT_1_CONCURRENTHASHINGWITHCHAINING_HPP
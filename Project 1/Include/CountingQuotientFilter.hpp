@@ -0,0 +1,539 @@
+#ifndef PROJECT_1_COUNTINGQUOTIENTFILTER_HPP
+#define PROJECT_1_COUNTINGQUOTIENTFILTER_HPP
+
+#include "Utilities.hpp"
+
+#include <bit>
+
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+#define CQF_REMAINDER_BIT_SIZE 8
+#define CQF_MAX_LOAD_FACTOR 0.95 // Default, the filter doubles before more of its home slots are used.
+#define CQF_BLOCK_SIZE 64 // Slots per block, i.e. per word of the metadata bitvectors.
+
+
+/*
+ * Counting quotient filter (Pandey, Bender, Johnson and Patro), an approximate multiset that, unlike
+ * a Bloom filter, supports deletions, counts, resizing and merging.
+ *
+ * A key's fingerprint is the top q + r bits of the multiply-shift product a * key. The top q bits
+ * (the quotient) select a home slot and the low r bits (the remainder) are stored. Remainders with
+ * the same quotient form a sorted run. Runs are kept in quotient order and pushed right, Robin Hood
+ * style, when their home slot is taken. Two bitvectors describe the runs: 'occupieds' marks the
+ * quotients that have a run and 'runends' marks the last slot of each run. Each block of 64 slots
+ * also stores an offset, the distance from its first slot to the end of the last run with a quotient
+ * up to that slot. With it, a rank over 'occupieds' and a select over 'runends' locate any run
+ * without scanning (the rank-and-select layout of the paper). There is no wraparound. Runs may
+ * spill into extra slots after the last home slot.
+ *
+ * Each distinct remainder is stored once. When it is held more than once it is followed by count
+ * digit slots, which hold count - 1 in base 2^r and are flagged in the bitvector 'counters'.
+ */
+template <typename key_type, typename array_type>
+class CountingQuotientFilter
+{
+private:
+    // Attributes
+    unsigned int q, r;                    // Quotient and remainder bits, a fingerprint has q + r bits.
+    uint64_t nr_quotients, nr_slots;      // 2^q home slots, plus room at the end for runs pushed past the last one.
+    uint64_t nr_used_slots, nr_keys;
+    uint64_t remainder_mask;
+    double max_load_factor;               // Used slots per home slot at which the filter doubles.
+
+    key_type a;
+
+    std::vector<uint64_t> occupieds, runends, counters;
+    std::vector<uint64_t> remainders;     // r bits per slot, packed.
+    std::vector<uint16_t> offsets;        // One per block.
+
+
+    // Standard un-parametrized C-tor, only used for resizing and merging.
+    CountingQuotientFilter() = default;
+
+    // Methods
+    void initialize(const unsigned int& quotient_bits, const unsigned int& remainder_bits, const key_type& multiplier)
+    {
+        if(remainder_bits == 0 || quotient_bits + remainder_bits > KEY_BIT_SIZE)
+        {
+            throw std::runtime_error("A counting quotient filter needs 1 to " + std::to_string(KEY_BIT_SIZE - quotient_bits) + " remainder bits.");
+        }
+        this->q = quotient_bits;
+        this->r = remainder_bits;
+        this->a = multiplier;
+        this->remainder_mask = (1ull << this->r) - 1;
+        this->nr_quotients = 1ull << this->q;
+        uint64_t nr_extra_slots = std::max<uint64_t>(CQF_BLOCK_SIZE, 10 * std::sqrt((double)this->nr_quotients));
+        this->nr_slots = (this->nr_quotients + nr_extra_slots + CQF_BLOCK_SIZE - 1) / CQF_BLOCK_SIZE * CQF_BLOCK_SIZE;
+        this->nr_used_slots = 0;
+        this->nr_keys = 0;
+
+        const uint64_t nr_blocks = this->nr_slots / CQF_BLOCK_SIZE;
+        this->occupieds.assign(nr_blocks, 0);
+        this->runends.assign(nr_blocks, 0);
+        this->counters.assign(nr_blocks, 0);
+        this->remainders.assign(this->nr_slots * this->r / 64 + 1, 0);
+        this->offsets.assign(nr_blocks, 0);
+    }
+
+    uint64_t fingerprint(const key_type& key) const
+    {
+        return hash(key, this->a, this->q + this->r);
+    }
+
+    static bool get_bit(const std::vector<uint64_t>& bits, const uint64_t& i)
+    {
+        return (bits[i / 64] >> (i % 64)) & 1;
+    }
+
+    static void set_bit(std::vector<uint64_t>& bits, const uint64_t& i, const bool& value)
+    {
+        if(value) bits[i / 64] |= 1ull << (i % 64);
+        else bits[i / 64] &= ~(1ull << (i % 64));
+    }
+
+    uint64_t get_remainder(const uint64_t& slot) const
+    {
+        const uint64_t bit = slot * this->r, word = bit / 64, shift = bit % 64;
+        uint64_t value = this->remainders[word] >> shift;
+        if(shift + this->r > 64) value |= this->remainders[word + 1] << (64 - shift);
+        return value & this->remainder_mask;
+    }
+
+    void set_remainder(const uint64_t& slot, const uint64_t& value)
+    {
+        const uint64_t bit = slot * this->r, word = bit / 64, shift = bit % 64;
+        this->remainders[word] = (this->remainders[word] & ~(this->remainder_mask << shift)) | (value << shift);
+        if(shift + this->r > 64)
+        {
+            const uint64_t high_mask = (1ull << (shift + this->r - 64)) - 1;
+            this->remainders[word + 1] = (this->remainders[word + 1] & ~high_mask) | (value >> (64 - shift));
+        }
+    }
+
+    void copy_slot(const uint64_t& from, const uint64_t& to)
+    {
+        set_remainder(to, get_remainder(from));
+        set_bit(this->runends, to, get_bit(this->runends, from));
+        set_bit(this->counters, to, get_bit(this->counters, from));
+    }
+
+    static unsigned int select_in_word(uint64_t word, const unsigned int& k)
+    {
+        /*
+         * Position of the (k+1)-th set bit of 'word'.
+         * */
+#if defined(__BMI2__)
+        return std::countr_zero(_pdep_u64(1ull << k, word));
+#else
+        for(unsigned int i = 0; i < k; i++) word &= word - 1;
+        return std::countr_zero(word);
+#endif
+    }
+
+    uint64_t count_ones(const std::vector<uint64_t>& bits, const uint64_t& from, const uint64_t& to) const
+    {
+        /*
+         * Rank, i.e. the number of set bits in the positions [from, to].
+         * */
+        if(from > to) return 0;
+        uint64_t count = 0;
+        for(uint64_t w = from / 64; w <= to / 64; w++)
+        {
+            uint64_t word = bits[w];
+            if(w == from / 64) word &= ~0ull << (from % 64);
+            if(w == to / 64 && to % 64 != 63) word &= (1ull << (to % 64 + 1)) - 1;
+            count += std::popcount(word);
+        }
+        return count;
+    }
+
+    uint64_t select(const std::vector<uint64_t>& bits, const uint64_t& start, uint64_t d) const
+    {
+        /*
+         * Position of the d-th (d >= 1) set bit at or after 'start', or 'nr_slots' if there is none.
+         * */
+        uint64_t w = start / 64;
+        if(w >= bits.size()) return this->nr_slots;
+        uint64_t word = bits[w] & (~0ull << (start % 64));
+        while(true)
+        {
+            const uint64_t count = std::popcount(word);
+            if(d <= count) return w * 64 + select_in_word(word, d - 1);
+            d -= count;
+            if(++w >= bits.size()) return this->nr_slots;
+            word = bits[w];
+        }
+    }
+
+    int64_t run_end_from(const uint64_t& x, const uint64_t& block) const
+    {
+        /*
+         * End of the last run with a quotient up to 'x', found from the offset of 'block' (which
+         * must start at or before 'x'). Returns a slot before the block if no such run reaches it.
+         * */
+        const uint64_t block_start = block * CQF_BLOCK_SIZE;
+        const uint64_t base = block_start + this->offsets[block];
+        // A run end at 'base' can only belong to a quotient up to 'block_start'.
+        const bool base_is_run_end = get_bit(this->runends, base);
+        const uint64_t d = count_ones(this->occupieds, block_start + 1, x);
+        if(d == 0) return base_is_run_end ? (int64_t)base : (int64_t)block_start - 1;
+        return select(this->runends, base_is_run_end ? base + 1 : base, d);
+    }
+
+    int64_t run_end(const uint64_t& x) const
+    {
+        return run_end_from(x, x / CQF_BLOCK_SIZE);
+    }
+
+    uint64_t run_start(const uint64_t& quotient) const
+    {
+        if(quotient == 0) return 0;
+        return std::max<int64_t>(quotient, run_end(quotient - 1) + 1);
+    }
+
+    uint64_t first_empty_slot(const uint64_t& slot) const
+    {
+        /*
+         * First slot at or after 'slot' that no run covers, or 'nr_slots' if there is none.
+         * */
+        uint64_t i = slot;
+        while(i < this->nr_slots)
+        {
+            int64_t end = run_end(i);
+            if(end < (int64_t)i) return i;
+            i = end + 1;
+        }
+        return this->nr_slots;
+    }
+
+    bool has_empty_slots(const uint64_t& slot, const unsigned int& nr_needed) const
+    {
+        uint64_t i = slot;
+        for(unsigned int found = 0; found < nr_needed; found++)
+        {
+            i = first_empty_slot(i);
+            if(i >= this->nr_slots) return false;
+            i++;
+        }
+        return true;
+    }
+
+    void update_offsets(const uint64_t& from, const uint64_t& to)
+    {
+        /*
+         * Recomputes the offsets of the blocks starting in [from, to], in order, as each offset is
+         * found from the one before it. Offsets of other blocks are not affected by a shift of the
+         * slots in [from, to].
+         * */
+        for(uint64_t block = (from + CQF_BLOCK_SIZE - 1) / CQF_BLOCK_SIZE; block <= to / CQF_BLOCK_SIZE; block++)
+        {
+            const uint64_t block_start = block * CQF_BLOCK_SIZE;
+            int64_t end;
+            if(block == 0) end = get_bit(this->occupieds, 0) ? (int64_t)select(this->runends, 0, 1) : -1;
+            else end = run_end_from(block_start, block - 1);
+            const int64_t offset = std::max<int64_t>(end - (int64_t)block_start, 0);
+            if(offset > std::numeric_limits<uint16_t>::max()) throw std::runtime_error("Counting quotient filter offset overflow.");
+            this->offsets[block] = offset;
+        }
+    }
+
+    void insert_slot(const uint64_t& quotient, const uint64_t& slot)
+    {
+        /*
+         * Opens an empty slot at 'slot' as part of the run of 'quotient', which is created if it does
+         * not exist. 'slot' has to be within the run or right after it (or at the start of the new
+         * run), and an empty slot has to exist after it. The slots up to the first empty one are
+         * shifted one to the right.
+         * */
+        const bool new_run = !get_bit(this->occupieds, quotient);
+        const bool at_run_end = !new_run && (int64_t)slot == run_end(quotient) + 1;
+        const uint64_t empty_slot = first_empty_slot(slot);
+        for(uint64_t i = empty_slot; i > slot; i--) copy_slot(i - 1, i);
+        set_bit(this->runends, slot, false);
+        set_bit(this->counters, slot, false);
+        if(new_run)
+        {
+            set_bit(this->occupieds, quotient, true);
+            set_bit(this->runends, slot, true);
+        }
+        else if(at_run_end)
+        {
+            set_bit(this->runends, slot - 1, false);
+            set_bit(this->runends, slot, true);
+        }
+        this->nr_used_slots++;
+        update_offsets(quotient, empty_slot);
+    }
+
+    void remove_slot(const uint64_t& quotient, const uint64_t& slot)
+    {
+        /*
+         * Removes 'slot' from the run of 'quotient'. The following runs of the cluster move one slot
+         * to the left, up to the first run that is already in its home slot.
+         * */
+        const uint64_t start = run_start(quotient);
+        const uint64_t end = run_end(quotient);
+        uint64_t shift_end = end;
+        for(uint64_t next = select(this->occupieds, quotient + 1, 1); next <= shift_end; next = select(this->occupieds, next + 1, 1))
+        {
+            shift_end = select(this->runends, shift_end + 1, 1);
+        }
+
+        if(slot == end)
+        {
+            if(slot == start) set_bit(this->occupieds, quotient, false);
+            else set_bit(this->runends, slot - 1, true);
+        }
+        for(uint64_t i = slot; i < shift_end; i++) copy_slot(i + 1, i);
+        set_remainder(shift_end, 0);
+        set_bit(this->runends, shift_end, false);
+        set_bit(this->counters, shift_end, false);
+        this->nr_used_slots--;
+        update_offsets(quotient, shift_end);
+    }
+
+    unsigned int nr_digits(uint64_t count) const
+    {
+        unsigned int digits = 0;
+        for(count--; count > 0; count >>= this->r) digits++;
+        return digits;
+    }
+
+    uint64_t read_count(const uint64_t& slot, const unsigned int& digits) const
+    {
+        uint64_t count = 0;
+        for(unsigned int i = digits; i > 0; i--) count = (count << this->r) | get_remainder(slot + i);
+        return count + 1;
+    }
+
+    void write_entry(const uint64_t& slot, const uint64_t& remainder, const uint64_t& count)
+    {
+        set_remainder(slot, remainder);
+        set_bit(this->counters, slot, false);
+        uint64_t rest = count - 1;
+        for(unsigned int i = 1; i <= nr_digits(count); i++, rest >>= this->r)
+        {
+            set_remainder(slot + i, rest & this->remainder_mask);
+            set_bit(this->counters, slot + i, true);
+        }
+    }
+
+    struct entry_type
+    {
+        bool found;
+        uint64_t slot;          // Slot of the remainder, or where it would be inserted.
+        unsigned int digits;    // Number of count digits after it.
+    };
+
+    entry_type find_entry(const uint64_t& quotient, const uint64_t& remainder) const
+    {
+        if(!get_bit(this->occupieds, quotient)) return {false, run_start(quotient), 0};
+        uint64_t slot = run_start(quotient);
+        const uint64_t end = run_end(quotient);
+        while(slot <= end)
+        {
+            unsigned int digits = 0;
+            while(slot + digits < end && get_bit(this->counters, slot + digits + 1)) digits++;
+            const uint64_t stored = get_remainder(slot);
+            if(stored == remainder) return {true, slot, digits};
+            if(stored > remainder) break;
+            slot += digits + 1;
+        }
+        return {false, slot, 0};
+    }
+
+    bool insert_fingerprint(const uint64_t& fingerprint, const uint64_t& count)
+    {
+        /*
+         * Adds 'count' copies of 'fingerprint'. Returns false, without changing anything, if the
+         * slots after the run are used up.
+         * */
+        const uint64_t quotient = fingerprint >> this->r, remainder = fingerprint & this->remainder_mask;
+        entry_type entry = find_entry(quotient, remainder);
+        if(entry.found)
+        {
+            const uint64_t new_count = read_count(entry.slot, entry.digits) + count;
+            const unsigned int new_digits = nr_digits(new_count);
+            if(!has_empty_slots(entry.slot, new_digits - entry.digits)) return false;
+            for(unsigned int i = entry.digits; i < new_digits; i++) insert_slot(quotient, entry.slot + i + 1);
+            write_entry(entry.slot, remainder, new_count);
+        }
+        else
+        {
+            const unsigned int digits = nr_digits(count);
+            if(!has_empty_slots(entry.slot, digits + 1)) return false;
+            for(unsigned int i = 0; i <= digits; i++) insert_slot(quotient, entry.slot + i);
+            write_entry(entry.slot, remainder, count);
+        }
+        this->nr_keys += count;
+        return true;
+    }
+
+    template <typename task_type>
+    void for_each_fingerprint(task_type task) const
+    {
+        /*
+         * Calls task(fingerprint, count) for every distinct fingerprint, in increasing order.
+         * */
+        uint64_t slot = 0;
+        for(uint64_t quotient = select(this->occupieds, 0, 1); quotient < this->nr_slots; quotient = select(this->occupieds, quotient + 1, 1))
+        {
+            slot = std::max(slot, quotient);
+            const uint64_t end = select(this->runends, slot, 1);
+            while(slot <= end)
+            {
+                unsigned int digits = 0;
+                while(slot + digits < end && get_bit(this->counters, slot + digits + 1)) digits++;
+                task((quotient << this->r) | get_remainder(slot), read_count(slot, digits));
+                slot += digits + 1;
+            }
+        }
+    }
+
+    void rebuild(const unsigned int& quotient_bits, const unsigned int& remainder_bits,
+                 const std::vector<const CountingQuotientFilter*>& sources)
+    {
+        /*
+         * Replaces this filter by one with the given sizes holding the fingerprints of 'sources',
+         * shortened to q + r bits. As fingerprints are the top bits of a * key, the shortened
+         * fingerprint is exactly that of a filter with fewer bits.
+         * */
+        CountingQuotientFilter rebuilt;
+        rebuilt.initialize(quotient_bits, remainder_bits, this->a);
+        rebuilt.max_load_factor = this->max_load_factor;
+        for(const CountingQuotientFilter* source : sources)
+        {
+            const unsigned int shift = source->q + source->r - quotient_bits - remainder_bits;
+            source->for_each_fingerprint([&](const uint64_t& fingerprint, const uint64_t& count)
+            {
+                if(!rebuilt.insert_fingerprint(fingerprint >> shift, count)) throw std::runtime_error("Counting quotient filter rebuilt too small.");
+            });
+        }
+        *this = std::move(rebuilt);
+    }
+
+public:
+
+    // Parameterized C-tor
+    [[maybe_unused]] explicit CountingQuotientFilter(const unsigned int& n, const unsigned int& seed, const unsigned int& remainder_bits = CQF_REMAINDER_BIT_SIZE,
+                                                     const double& max_load_factor = CQF_MAX_LOAD_FACTOR)
+    {
+        /*
+         * Sized for n keys at up to 'max_load_factor' used slots per home slot. The number of home
+         * slots is a power of 2, so a filter sized for n keys is between half and fully loaded at n,
+         * e.g. for n = 2^20 and 0.95 half loaded. With n being exactly the number of home slots,
+         * a maximum load factor of 1 fills them instead (the extra slots at the end take the runs
+         * that spill over).
+         */
+        if(max_load_factor <= 0.0 || max_load_factor > 1.0) throw std::runtime_error("Max load factor given to CountingQuotientFilter C-tor should be in (0, 1].");
+        this->max_load_factor = max_load_factor;
+        unsigned int quotient_bits = 6;
+        while((1ull << quotient_bits) * this->max_load_factor < n) quotient_bits++;
+        initialize(quotient_bits, std::min(remainder_bits, KEY_BIT_SIZE - quotient_bits), get_random_odd_uint32(seed));
+    }
+
+    // Methods
+    void insert(const key_type& key, const uint64_t& count = 1)
+    {
+        /*
+         * Adds 'count' copies of the key. The filter doubles first if it would pass its maximum
+         * load factor (or run out of slots at the end).
+         */
+        if(count == 0) return;
+        if(this->nr_used_slots + 1 + nr_digits(count) > this->max_load_factor * this->nr_quotients) resize();
+        while(!insert_fingerprint(fingerprint(key), count)) resize();
+    }
+
+    void insert_keys(const array_type& keys)
+    {
+        for(key_type key : keys) insert(key);
+    }
+
+    bool remove(const key_type& key, const uint64_t& count = 1)
+    {
+        /*
+         * Removes up to 'count' copies of the key. Returns whether the key was held at all. As with
+         * any filter, removing a key that was never inserted may remove a colliding one.
+         */
+        const uint64_t f = fingerprint(key);
+        const uint64_t quotient = f >> this->r, remainder = f & this->remainder_mask;
+        entry_type entry = find_entry(quotient, remainder);
+        if(!entry.found) return false;
+
+        const uint64_t old_count = read_count(entry.slot, entry.digits);
+        const uint64_t new_count = old_count - std::min(count, old_count);
+        const unsigned int new_digits = new_count == 0 ? 0 : nr_digits(new_count);
+        const unsigned int nr_kept_slots = new_count == 0 ? 0 : new_digits + 1;
+        // Slots are removed from the back, so that the entry stays well formed in between.
+        for(unsigned int i = entry.digits + 1; i > nr_kept_slots; i--) remove_slot(quotient, entry.slot + i - 1);
+        if(new_count > 0) write_entry(entry.slot, remainder, new_count);
+        this->nr_keys -= old_count - new_count;
+        return true;
+    }
+
+    uint64_t count(const key_type& key) const
+    {
+        /*
+         * Number of copies of the key. Never too small, too large only if another key has the
+         * same fingerprint.
+         */
+        const uint64_t f = fingerprint(key);
+        entry_type entry = find_entry(f >> this->r, f & this->remainder_mask);
+        return entry.found ? read_count(entry.slot, entry.digits) : 0;
+    }
+
+    bool may_contain(const key_type& key) const
+    {
+        /*
+         * False means that the key is not held, true that it probably is.
+         */
+        const uint64_t f = fingerprint(key);
+        if(!get_bit(this->occupieds, f >> this->r)) return false;
+        return find_entry(f >> this->r, f & this->remainder_mask).found;
+    }
+
+    void resize()
+    {
+        /*
+         * Doubles the number of home slots. The fingerprints are kept, one bit moving from the
+         * remainder to the quotient, so the false positive rate of the held keys doubles too.
+         */
+        if(this->r <= 1) throw std::runtime_error("Counting quotient filter has no remainder bits left to grow with.");
+        rebuild(this->q + 1, this->r - 1, {this});
+    }
+
+    void merge(const CountingQuotientFilter& other)
+    {
+        /*
+         * Adds the keys (and counts) of 'other', which must be built with the same seed. The merged
+         * filter keeps the shorter of the two fingerprint sizes.
+         */
+        if(other.a != this->a) throw std::runtime_error("Only counting quotient filters with the same seed can be merged.");
+        const unsigned int fingerprint_bits = std::min(this->q + this->r, other.q + other.r);
+        unsigned int quotient_bits = std::max(this->q, other.q);
+        while((1ull << quotient_bits) * this->max_load_factor < this->nr_used_slots + other.nr_used_slots) quotient_bits++;
+        if(quotient_bits >= fingerprint_bits) throw std::runtime_error("Merged counting quotient filter has no remainder bits left.");
+        rebuild(quotient_bits, fingerprint_bits - quotient_bits, {this, &other});
+    }
+
+    uint64_t size() const
+    {
+        return this->nr_keys;
+    }
+
+    double load_factor() const
+    {
+        return (double)this->nr_used_slots / this->nr_quotients;
+    }
+
+    uint64_t size_in_bytes() const
+    {
+        return sizeof(*this) + (this->occupieds.size() + this->runends.size() + this->counters.size() + this->remainders.size()) * sizeof(uint64_t)
+               + this->offsets.size() * sizeof(uint16_t);
+    }
+
+};
+
+#endif //PROJECT_1_COUNTINGQUOTIENTFILTER_HPP
@@ -0,0 +1,281 @@
+#ifndef PROJECT_1_CUCKOOHASHSET_HPP
+#define PROJECT_1_CUCKOOHASHSET_HPP
+
+#include "Utilities.hpp"
+
+#include <bit>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#define CUCKOO_BUCKET_SIZE 8
+#define CUCKOO_STASH_SIZE 8
+#define CUCKOO_MAX_BFS_NODES 512
+
+
+template <typename key_type, typename array_type>
+class CuckooHashSet
+{
+private:
+    // 8 keys of 32 bits fill exactly one 256-bit register, and with the alignment a bucket never straddles two cache lines.
+    struct alignas(32) bucket_type
+    {
+        key_type keys[CUCKOO_BUCKET_SIZE];
+    };
+    using bucket_array_type = std::vector<bucket_type>;
+
+    struct bfs_node_type
+    {
+        unsigned int bucket;
+        int parent; // Index of the node in the BFS queue whose key is moved into 'bucket', -1 for the two start buckets.
+        int slot;   // Slot in the parent bucket holding that key.
+    };
+
+    // Attributes
+    unsigned int nr_buckets, nr_keys, seed, seed_shift;
+
+    key_type a_1, a_2, l;
+
+    double max_load_factor;
+
+    // The largest key is used to mark empty slots, so if it is inserted itself it is kept out of the buckets.
+    const key_type empty_key = std::numeric_limits<key_type>::max();
+    bool holds_empty_key;
+
+
+    // Methods
+    void initialize_buckets()
+    {
+        bucket_type empty_bucket;
+        std::fill(std::begin(empty_bucket.keys), std::end(empty_bucket.keys), this->empty_key);
+        this->buckets.assign(this->nr_buckets, empty_bucket);
+        this->stash.clear();
+    }
+
+    void initialize_consts()
+    {
+        /*
+         * Two independently drawn multiply-shift functions. A new pair is
+         * drawn every time the table has to be rebuilt.
+         * */
+
+        this->a_1 = get_random_odd_uint32(this->seed + this->seed_shift * 11);
+        this->seed_shift++;
+        do
+        {
+            this->a_2 = get_random_odd_uint32(this->seed + this->seed_shift * 11);
+            this->seed_shift++;
+        } while(this->a_2 == this->a_1);
+        this->l = std::log2(this->nr_buckets); // if m = 2^l then l = log2(m)
+    }
+
+    int find_in_bucket(const unsigned int& bucket, const key_type& key)
+    {
+        /*
+         * Returns the slot of 'key' in the given bucket or -1, comparing all 8 slots at once.
+         * */
+        const key_type* keys = this->buckets[bucket].keys;
+#if defined(__AVX2__)
+        __m256i equal = _mm256_cmpeq_epi32(_mm256_load_si256(reinterpret_cast<const __m256i*>(keys)), _mm256_set1_epi32((int)key));
+        unsigned int mask = _mm256_movemask_ps(_mm256_castsi256_ps(equal));
+#elif defined(__SSE2__)
+        __m128i query = _mm_set1_epi32((int)key);
+        __m128i low = _mm_cmpeq_epi32(_mm_load_si128(reinterpret_cast<const __m128i*>(keys)), query);
+        __m128i high = _mm_cmpeq_epi32(_mm_load_si128(reinterpret_cast<const __m128i*>(keys + 4)), query);
+        unsigned int mask = _mm_movemask_ps(_mm_castsi128_ps(low)) | (_mm_movemask_ps(_mm_castsi128_ps(high)) << 4);
+#else
+        unsigned int mask = 0;
+        for(unsigned int slot = 0; slot < CUCKOO_BUCKET_SIZE; slot++)
+        {
+            if(keys[slot] == key) mask |= (1u << slot);
+        }
+#endif
+        if(mask == 0) return -1;
+        return std::countr_zero(mask);
+    }
+
+    unsigned int alternative_bucket(const key_type& key, const unsigned int& bucket)
+    {
+        unsigned int bucket_1 = hash(key, this->a_1, this->l);
+        return bucket_1 == bucket ? hash(key, this->a_2, this->l) : bucket_1;
+    }
+
+    bool place(const key_type& key)
+    {
+        /*
+         * Puts 'key' in one of its two buckets. If both are full, a breadth first search over
+         * evictions finds the shortest chain of keys that can be moved to their alternative
+         * bucket, ending in a bucket with a free slot. The chain is then applied backwards.
+         * If no such chain is found within the node budget, the key goes to the stash.
+         * Returns false only if the stash is full as well.
+         * */
+        std::vector<bfs_node_type> queue;
+        queue.reserve(CUCKOO_MAX_BFS_NODES);
+        queue.push_back({(unsigned int)hash(key, this->a_1, this->l), -1, -1});
+        queue.push_back({(unsigned int)hash(key, this->a_2, this->l), -1, -1});
+
+        for(unsigned int i = 0; i < queue.size(); i++)
+        {
+            int free_slot = find_in_bucket(queue[i].bucket, this->empty_key);
+            if(free_slot != -1)
+            {
+                // Moving keys along the path, starting from the end that has the free slot.
+                int node = i;
+                while(queue[node].parent != -1)
+                {
+                    const bfs_node_type& parent = queue[queue[node].parent];
+                    this->buckets[queue[node].bucket].keys[free_slot] = this->buckets[parent.bucket].keys[queue[node].slot];
+                    free_slot = queue[node].slot;
+                    node = queue[node].parent;
+                }
+                this->buckets[queue[node].bucket].keys[free_slot] = key;
+                return true;
+            }
+
+            for(int slot = 0; slot < CUCKOO_BUCKET_SIZE && queue.size() < CUCKOO_MAX_BFS_NODES; slot++)
+            {
+                key_type evicted = this->buckets[queue[i].bucket].keys[slot];
+                queue.push_back({alternative_bucket(evicted, queue[i].bucket), (int)i, slot});
+            }
+        }
+
+        if(this->stash.size() < CUCKOO_STASH_SIZE)
+        {
+            this->stash.push_back(key);
+            return true;
+        }
+        return false;
+    }
+
+    void rebuild(const unsigned int& new_nr_buckets, const key_type& pending_key)
+    {
+        /*
+         * Re-inserts all keys (and 'pending_key') into 'new_nr_buckets' buckets with freshly drawn
+         * hash functions, retrying with new functions until every key finds room.
+         * */
+        array_type keys;
+        keys.reserve(this->nr_keys + 1);
+        for(const bucket_type& bucket : this->buckets)
+        {
+            for(key_type key : bucket.keys)
+            {
+                if(key != this->empty_key) keys.push_back(key);
+            }
+        }
+        keys.insert(keys.end(), this->stash.begin(), this->stash.end());
+        keys.push_back(pending_key);
+
+        this->nr_buckets = new_nr_buckets;
+        bool placed_all = false;
+        while(!placed_all)
+        {
+            initialize_buckets();
+            initialize_consts();
+            placed_all = true;
+            for(key_type key : keys)
+            {
+                if(!place(key))
+                {
+                    placed_all = false;
+                    break;
+                }
+            }
+        }
+    }
+
+public:
+
+    // Attributes
+    bucket_array_type buckets;
+    array_type stash;
+
+    // Parameterized C-tor
+    [[maybe_unused]] explicit CuckooHashSet(const unsigned int& n, const unsigned int& seed, const double& max_load_factor = 0.95)
+    {
+        if(max_load_factor <= 0.0 || max_load_factor >= 1.0) throw std::runtime_error("Max load factor given to CuckooHashSet C-tor should be in (0,1).");
+        this->max_load_factor = max_load_factor;
+        this->nr_keys = 0;
+        this->holds_empty_key = false;
+        this->seed = seed;
+        this->seed_shift = 0;
+        this->nr_buckets = 2;
+        while((double)n > this->max_load_factor * this->nr_buckets * CUCKOO_BUCKET_SIZE) this->nr_buckets *= 2;
+        initialize_buckets();
+        initialize_consts();
+    }
+
+    // Methods
+    void insert(const key_type& key)
+    {
+        if(key == this->empty_key)
+        {
+            this->holds_empty_key = true;
+            return;
+        }
+        if(holds(key)) return; // Set semantics, i.e. no duplicates.
+
+        // Only a full table or a full stash triggers a rebuild, every other insertion is local.
+        if((double)(this->nr_keys + 1) > this->max_load_factor * this->nr_buckets * CUCKOO_BUCKET_SIZE) rebuild(2 * this->nr_buckets, key);
+        else if(!place(key)) rebuild(this->nr_buckets, key);
+        this->nr_keys++;
+    }
+
+    void insert_keys(const array_type& keys)
+    {
+        for(key_type key : keys) insert(key);
+    }
+
+    bool holds(const key_type& key)
+    {
+        /*
+         * Checks whether the provided key is stored in the hash table.
+         * At most two buckets (each within one cache line) plus the small stash are inspected.
+         */
+        if(key == this->empty_key) return this->holds_empty_key;
+
+        if(find_in_bucket(hash(key, this->a_1, this->l), key) != -1) return true;
+        if(find_in_bucket(hash(key, this->a_2, this->l), key) != -1) return true;
+        if(!this->stash.empty())
+        {
+            return std::find(this->stash.begin(), this->stash.end(), key) != this->stash.end();
+        }
+        return false;
+    }
+
+    bool remove(const key_type& key)
+    {
+        if(key == this->empty_key)
+        {
+            bool was_held = this->holds_empty_key;
+            this->holds_empty_key = false;
+            return was_held;
+        }
+
+        for(unsigned int bucket : {(unsigned int)hash(key, this->a_1, this->l), (unsigned int)hash(key, this->a_2, this->l)})
+        {
+            int slot = find_in_bucket(bucket, key);
+            if(slot != -1)
+            {
+                this->buckets[bucket].keys[slot] = this->empty_key;
+                this->nr_keys--;
+                return true;
+            }
+        }
+        auto iterator = std::find(this->stash.begin(), this->stash.end(), key);
+        if(iterator == this->stash.end()) return false;
+        this->stash.erase(iterator);
+        this->nr_keys--;
+        return true;
+    }
+
+    double load_factor()
+    {
+        return (double)this->nr_keys / (this->nr_buckets * CUCKOO_BUCKET_SIZE);
+    }
+
+};
+
+#endif //PROJECT_1_CUCKOOHASHSET_HPP
@@ -0,0 +1,292 @@
+#ifndef PROJECT_1_DYNAMICPERFECTHASHING_HPP
+#define PROJECT_1_DYNAMICPERFECTHASHING_HPP
+
+#include "Utilities.hpp"
+
+// The structure is rebuilt after (1 + DPH_GROWTH_CONST) * n updates, n being the number of keys at the last full rebuild.
+#define DPH_GROWTH_CONST 1
+
+
+/*
+ * Dynamic perfect hashing of Dietzfelbinger, Karlin, Mehlhorn, Meyer auf der Heide, Rohnert and
+ * Tarjan. Same two levels of multiply-shift hashing as 'PerfectHashing', but every bucket j reserves
+ * room for up to m_j keys, with an inner table of 2 m_j (m_j - 1) slots (rounded up to a power of two).
+ * Lookups inspect one slot. An insertion that collides in its inner table rebuilds only that inner
+ * table, one that exceeds m_j doubles m_j first, and only when the total space passes its bound
+ * or after M updates is everything rebuilt. Updates are thereby amortized O(1).
+ */
+template <typename key_type, typename array_type>
+class DynamicPerfectHashing
+{
+private:
+    struct bucket_type
+    {
+        key_type a, l;           // Inner multiply-shift parameters, l = log2(slots.size()).
+        unsigned int nr_keys;
+        unsigned int limit;      // m_j, the number of keys the inner table is sized for.
+        array_type slots;
+    };
+
+    // Attributes
+    unsigned int m, seed, seed_shift;
+
+    key_type a, l;
+
+    unsigned int nr_keys, nr_updates, max_nr_updates; // max_nr_updates is M in the paper.
+    uint64_t nr_slots;
+
+    // The largest key is used to mark empty slots, so if it is inserted itself it is kept out of the slots.
+    const key_type empty_key = std::numeric_limits<key_type>::max();
+    bool holds_empty_key;
+
+
+    // Methods
+    key_type next_const()
+    {
+        key_type constant = get_random_odd_uint32(this->seed + this->seed_shift * 11);
+        this->seed_shift++;
+        return constant;
+    }
+
+    static uint64_t inner_table_size(const uint64_t& limit)
+    {
+        /*
+         * 2 m_j (m_j - 1) rounded up to a power of two, at least 2. With multiply-shift being
+         * 2-approximately universal, a random inner constant is then collision free for m_j keys
+         * with probability at least 1/2.
+         * */
+        uint64_t size = 2;
+        while(size < 2 * limit * (limit - 1)) size *= 2;
+        return size;
+    }
+
+    uint64_t max_nr_slots()
+    {
+        /*
+         * Space bound of the scheme, 32 M^2 / s(M) + 4 M where s(M) is the number of buckets.
+         * */
+        return 32 * (uint64_t)this->max_nr_updates * this->max_nr_updates / this->m + 4 * (uint64_t)this->max_nr_updates;
+    }
+
+    key_type inner_index(const bucket_type& bucket, const key_type& key)
+    {
+        return hash(key, bucket.a, bucket.l);
+    }
+
+    void build_bucket(bucket_type& bucket, const array_type& keys)
+    {
+        /*
+         * Places 'keys' in the bucket's inner table (of the size implied by its limit), drawing
+         * new inner constants until no two keys collide.
+         * */
+        uint64_t size = inner_table_size(bucket.limit);
+        bucket.l = std::log2(size);
+        bucket.nr_keys = keys.size();
+        bool collision_free = false;
+        while(!collision_free)
+        {
+            bucket.a = next_const();
+            bucket.slots.assign(size, this->empty_key);
+            collision_free = true;
+            for(key_type key : keys)
+            {
+                key_type& slot = bucket.slots[inner_index(bucket, key)];
+                if(slot != this->empty_key)
+                {
+                    collision_free = false;
+                    break;
+                }
+                slot = key;
+            }
+        }
+    }
+
+    array_type keys_of(const bucket_type& bucket)
+    {
+        array_type keys;
+        keys.reserve(bucket.nr_keys + 1);
+        for(key_type key : bucket.slots)
+        {
+            if(key != this->empty_key) keys.push_back(key);
+        }
+        return keys;
+    }
+
+    void rebuild_all(const array_type& keys, const unsigned int& capacity)
+    {
+        /*
+         * Full rebuild over 'keys'. M and the number of buckets are chosen for 'capacity' keys
+         * (at least the number of keys), and outer constants are drawn until the inner tables fit
+         * in the space bound.
+         * */
+        this->nr_keys = keys.size();
+        this->nr_updates = 0;
+        this->max_nr_updates = (1 + DPH_GROWTH_CONST) * std::max(capacity, 4u);
+        this->m = 2;
+        while(this->m < capacity) this->m *= 2;
+        this->l = std::log2(this->m);
+
+        std::vector<array_type> grouped_keys(this->m);
+        do
+        {
+            this->a = next_const();
+            for(array_type& group : grouped_keys) group.clear();
+            for(key_type key : keys) grouped_keys[hash(key, this->a, this->l)].push_back(key);
+
+            this->nr_slots = 0;
+            for(const array_type& group : grouped_keys)
+            {
+                if(!group.empty()) this->nr_slots += inner_table_size(2 * group.size());
+            }
+        } while(this->nr_slots > max_nr_slots());
+
+        this->buckets.assign(this->m, bucket_type{0, 0, 0, 0, {}});
+        for(unsigned int j = 0; j < this->m; j++)
+        {
+            if(grouped_keys[j].empty()) continue;
+            this->buckets[j].limit = 2 * grouped_keys[j].size();
+            build_bucket(this->buckets[j], grouped_keys[j]);
+        }
+    }
+
+    array_type all_keys()
+    {
+        array_type keys;
+        keys.reserve(this->nr_keys + 1);
+        for(const bucket_type& bucket : this->buckets)
+        {
+            for(key_type key : bucket.slots)
+            {
+                if(key != this->empty_key) keys.push_back(key);
+            }
+        }
+        return keys;
+    }
+
+public:
+
+    // Attributes
+    std::vector<bucket_type> buckets;
+
+    // Parameterized C-tor
+    [[maybe_unused]] explicit DynamicPerfectHashing(const unsigned int& n, const unsigned int& seed)
+    {
+        this->seed = seed;
+        this->seed_shift = 0;
+        this->holds_empty_key = false;
+        rebuild_all({}, n);
+    }
+
+    // Methods
+    void insert(const key_type& key)
+    {
+        if(key == this->empty_key)
+        {
+            this->holds_empty_key = true;
+            return;
+        }
+        if(holds(key)) return; // Set semantics, i.e. no duplicates.
+
+        this->nr_updates++;
+        if(this->nr_updates > this->max_nr_updates)
+        {
+            array_type keys = all_keys();
+            keys.push_back(key);
+            rebuild_all(keys, keys.size());
+            return;
+        }
+
+        this->nr_keys++;
+        bucket_type& bucket = this->buckets[hash(key, this->a, this->l)];
+        if(bucket.nr_keys + 1 <= bucket.limit)
+        {
+            key_type& slot = bucket.slots[inner_index(bucket, key)];
+            if(slot == this->empty_key)
+            {
+                slot = key;
+                bucket.nr_keys++;
+                return;
+            }
+            // Collision, only this inner table is rebuilt, with the same size.
+            array_type keys = keys_of(bucket);
+            keys.push_back(key);
+            build_bucket(bucket, keys);
+            return;
+        }
+
+        // The bucket outgrew its limit, so it gets twice the room unless that breaks the space bound.
+        uint64_t old_size = bucket.slots.size();
+        bucket.limit = 2 * std::max(bucket.limit, 1u);
+        this->nr_slots += inner_table_size(bucket.limit) - old_size;
+        if(this->nr_slots > max_nr_slots())
+        {
+            array_type keys = all_keys();
+            keys.push_back(key);
+            rebuild_all(keys, keys.size());
+            return;
+        }
+        array_type keys = keys_of(bucket);
+        keys.push_back(key);
+        build_bucket(bucket, keys);
+    }
+
+    void insert_keys(const array_type& keys)
+    {
+        for(key_type key : keys) insert(key);
+    }
+
+    bool holds(const key_type& key)
+    {
+        /*
+         * Checks whether the provided key is stored in the hash table, with a single probe.
+         */
+        if(key == this->empty_key) return this->holds_empty_key;
+
+        const bucket_type& bucket = this->buckets[hash(key, this->a, this->l)];
+        if(bucket.slots.empty()) return false;
+        return bucket.slots[inner_index(bucket, key)] == key;
+    }
+
+    bool remove(const key_type& key)
+    {
+        /*
+         * Removes the provided key (if present). The slot is simply emptied. Deletions count as
+         * updates, so a structure that shrinks a lot is rebuilt to a smaller size eventually.
+         */
+        if(key == this->empty_key)
+        {
+            bool was_held = this->holds_empty_key;
+            this->holds_empty_key = false;
+            return was_held;
+        }
+
+        bucket_type& bucket = this->buckets[hash(key, this->a, this->l)];
+        if(bucket.slots.empty()) return false;
+        key_type& slot = bucket.slots[inner_index(bucket, key)];
+        if(slot != key) return false;
+
+        slot = this->empty_key;
+        bucket.nr_keys--;
+        this->nr_keys--;
+        this->nr_updates++;
+        if(this->nr_updates > this->max_nr_updates)
+        {
+            array_type keys = all_keys();
+            rebuild_all(keys, keys.size());
+        }
+        return true;
+    }
+
+    unsigned int size()
+    {
+        return this->nr_keys + this->holds_empty_key;
+    }
+
+    uint64_t size_in_bytes()
+    {
+        return sizeof(*this) + this->buckets.capacity() * sizeof(bucket_type) + this->nr_slots * sizeof(key_type);
+    }
+
+};
+
+#endif //PROJECT_1_DYNAMICPERFECTHASHING_HPP
@@ -0,0 +1,260 @@
+#ifndef PROJECT_1_ELIASFANOSET_HPP
+#define PROJECT_1_ELIASFANOSET_HPP
+
+#include "Utilities.hpp"
+#include "CompactVector.hpp"
+
+#include <bit>
+#include <optional>
+
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+#define ELIAS_FANO_SAMPLE_RATE 256 // Every 256th one and zero of the high bits has its position sampled.
+
+
+/*
+ * Static ordered set of the keys as an Elias-Fano coded increasing sequence. With n keys below a
+ * universe of U, every key is split into its low l = floor(log2(U / n)) bits, stored as they are in
+ * a compact vector, and its high bits h, stored in unary: key number i sets bit h + i of a bitvector
+ * of about 2n bits. The keys of one high value, a bucket, are thereby a run of ones, and bucket h
+ * starts right after the h-th zero. That is about 2 + log2(U / n) bits per key, e.g. 9 bits for the
+ * keys 0, 100, 200, ... of 'generate_ordered_keys', against 32 for the keys alone.
+ *
+ * The positions of every 256th one and zero are sampled, so finding a bucket ('next_geq', 'holds')
+ * or the i-th key ('access') is a jump to a sample and a popcount scan of a few words. Iterating the
+ * keys in order decodes them one by one, stepping to the next one bit.
+ *
+ * Built once by 'insert_keys', then only queried.
+ */
+template <typename key_type, typename array_type>
+class EliasFanoSet
+{
+private:
+    // Attributes
+    uint64_t n;
+    unsigned int low_bit_size;
+    key_type max_key;
+    CompactVector low_bits;
+    std::vector<uint64_t> high_bits;  // One word of slack after the last one.
+    std::vector<uint64_t> one_samples, zero_samples;
+
+
+    // Methods
+    static unsigned int select_in_word(const uint64_t& word, const unsigned int& k)
+    {
+        /*
+         * Position of the k-th (from 0) set bit of the word, which must have more than k set bits.
+         * */
+#if defined(__BMI2__)
+        return std::countr_zero(_pdep_u64(1ull << k, word));
+#else
+        uint64_t remaining = word;
+        for(unsigned int j = 0; j < k; j++) remaining &= remaining - 1;
+        return std::countr_zero(remaining);
+#endif
+    }
+
+    template <bool ones>
+    uint64_t select(const std::vector<uint64_t>& samples, const uint64_t& k) const
+    {
+        /*
+         * Position of the k-th (from 0) one, or zero, of the high bits. From the sampled position
+         * before it, whole words are skipped by their popcounts.
+         * */
+        const uint64_t sample = samples[k / ELIAS_FANO_SAMPLE_RATE];
+        uint64_t remaining = k % ELIAS_FANO_SAMPLE_RATE, word_index = sample / 64;
+        uint64_t word = (ones ? this->high_bits[word_index] : ~this->high_bits[word_index]) & (~0ull << (sample % 64));
+        for(unsigned int count = std::popcount(word); remaining >= count; count = std::popcount(word))
+        {
+            remaining -= count;
+            word_index++;
+            word = ones ? this->high_bits[word_index] : ~this->high_bits[word_index];
+        }
+        return word_index * 64 + select_in_word(word, remaining);
+    }
+
+    uint64_t next_one(const uint64_t& position) const
+    {
+        // Position of the first one at or after 'position', which there must be.
+        uint64_t word_index = position / 64;
+        uint64_t word = this->high_bits[word_index] & (~0ull << (position % 64));
+        while(word == 0) word = this->high_bits[++word_index];
+        return word_index * 64 + std::countr_zero(word);
+    }
+
+    bool bit(const uint64_t& position) const
+    {
+        return (this->high_bits[position / 64] >> (position % 64)) & 1;
+    }
+
+    key_type decode(const uint64_t& i, const uint64_t& position) const
+    {
+        // Key number i, its one being at 'position'.
+        return (key_type)(((position - i) << this->low_bit_size) | this->low_bits.get(i));
+    }
+
+public:
+
+    class iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = key_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const key_type*;
+        using reference = const key_type&;
+
+        iterator() = default;
+        iterator(const EliasFanoSet* set, const uint64_t& i, const uint64_t& position) : set(set), i(i), position(position)
+        {
+            if(this->i < this->set->n) this->key = this->set->decode(this->i, this->position);
+        }
+
+        reference operator*() const { return this->key; }
+        pointer operator->() const { return &this->key; }
+
+        iterator& operator++()
+        {
+            if(++this->i < this->set->n)
+            {
+                this->position = this->set->next_one(this->position + 1);
+                this->key = this->set->decode(this->i, this->position);
+            }
+            return *this;
+        }
+        iterator operator++(int)
+        {
+            iterator previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        bool operator==(const iterator& other) const { return this->i == other.i; }
+
+    private:
+        const EliasFanoSet* set = nullptr;
+        uint64_t i = 0;         // Index of the key, n at the end.
+        uint64_t position = 0;  // Position of its one in the high bits.
+        key_type key = 0;
+    };
+
+    // Standard un-parametrized C-tor.
+    EliasFanoSet() : n(0), low_bit_size(0), max_key(0) {}
+
+    // Methods
+    void insert_keys(const array_type& keys)
+    {
+        /*
+         * Rebuilds the set over its current keys plus 'keys'.
+         */
+        array_type sorted_keys(begin(), end());
+        sorted_keys.insert(sorted_keys.end(), keys.begin(), keys.end());
+        std::sort(sorted_keys.begin(), sorted_keys.end());
+        sorted_keys.erase(std::unique(sorted_keys.begin(), sorted_keys.end()), sorted_keys.end());
+        this->n = sorted_keys.size();
+        this->max_key = this->n == 0 ? 0 : sorted_keys.back();
+
+        const uint64_t universe = (uint64_t)this->max_key + 1;
+        this->low_bit_size = universe > this->n && this->n > 0 ? std::bit_width(universe / this->n) - 1 : 0;
+        this->low_bits = CompactVector(this->n, this->low_bit_size);
+        const uint64_t nr_high_bits = this->n + (this->max_key >> this->low_bit_size) + 1;
+        this->high_bits.assign(nr_high_bits / 64 + 2, 0);
+        for(uint64_t i = 0; i < this->n; i++)
+        {
+            this->low_bits.set(i, sorted_keys[i]);
+            const uint64_t position = ((uint64_t)sorted_keys[i] >> this->low_bit_size) + i;
+            this->high_bits[position / 64] |= 1ull << (position % 64);
+        }
+
+        // The positions of the 0th, 256th, 512th, ... one and zero.
+        this->one_samples.clear();
+        this->zero_samples.clear();
+        uint64_t nr_ones = 0, nr_zeros = 0;
+        for(uint64_t position = 0; position < nr_high_bits; position++)
+        {
+            if(bit(position))
+            {
+                if(nr_ones++ % ELIAS_FANO_SAMPLE_RATE == 0) this->one_samples.push_back(position);
+            }
+            else if(nr_zeros++ % ELIAS_FANO_SAMPLE_RATE == 0) this->zero_samples.push_back(position);
+        }
+    }
+
+    key_type access(const uint64_t& i) const
+    {
+        /*
+         * The i-th smallest key, i < n.
+         */
+        return decode(i, select<true>(this->one_samples, i));
+    }
+
+    iterator at(const uint64_t& i) const
+    {
+        /*
+         * Iterator to the i-th smallest key, i <= n. Stepping it on is cheaper than another 'access'.
+         */
+        if(i >= this->n) return end();
+        return iterator(this, i, select<true>(this->one_samples, i));
+    }
+
+    iterator lower_bound(const key_type& key) const
+    {
+        /*
+         * Iterator to the smallest key not less than 'key'. The bucket of 'key' starts after zero
+         * number h - 1, and its keys are compared by their low bits. If they are all less, the
+         * answer is the first key of a later bucket, i.e. at the next one.
+         */
+        if(this->n == 0 || key > this->max_key) return end();
+        const uint64_t high = (uint64_t)key >> this->low_bit_size;
+        uint64_t position = high == 0 ? 0 : select<false>(this->zero_samples, high - 1) + 1;
+        uint64_t i = position - high;
+        const uint64_t key_low = key & ((1ull << this->low_bit_size) - 1);
+        for(; bit(position); i++, position++)
+        {
+            if(this->low_bits.get(i) >= key_low) return iterator(this, i, position);
+        }
+        return iterator(this, i, next_one(position));
+    }
+
+    std::optional<key_type> next_geq(const key_type& key) const
+    {
+        /*
+         * Smallest key not less than 'key', if any.
+         */
+        iterator it = lower_bound(key);
+        if(it == end()) return std::nullopt;
+        return *it;
+    }
+
+    bool holds(const key_type& key) const
+    {
+        iterator it = lower_bound(key);
+        return it != end() && *it == key;
+    }
+
+    iterator begin() const
+    {
+        return this->n == 0 ? end() : iterator(this, 0, next_one(0));
+    }
+
+    iterator end() const
+    {
+        return iterator(this, this->n, 0);
+    }
+
+    uint64_t size() const
+    {
+        return this->n;
+    }
+
+    uint64_t size_in_bytes() const
+    {
+        return sizeof(*this) + this->low_bits.size_in_bytes() - sizeof(CompactVector)
+               + (this->high_bits.capacity() + this->one_samples.capacity() + this->zero_samples.capacity()) * sizeof(uint64_t);
+    }
+
+};
+
+#endif //PROJECT_1_ELIASFANOSET_HPP
@@ -0,0 +1,189 @@
+#ifndef PROJECT_1_EYTZINGERSET_HPP
+#define PROJECT_1_EYTZINGERSET_HPP
+
+#include "Utilities.hpp"
+
+#include <bit>
+
+
+/*
+ * Static ordered set of the keys laid out in Eytzinger (BFS) order: the root at index 1 and the
+ * children of index k at 2k and 2k + 1, so a search is a walk down an implicit binary search tree
+ * with no pointers, i.e. 'sizeof(key_type)' bytes per key against ~40 for a std::set node.
+ * The search is branchless, and as the 16 descendants of a node 4 levels down share one cache line
+ * (with 4-byte keys), that line is prefetched while the next 4 levels are searched.
+ *
+ * Built once by 'insert_keys', then only queried. Iteration follows the in-order successor of the
+ * implicit tree.
+ */
+template <typename key_type, typename array_type>
+class EytzingerSet
+{
+private:
+    static constexpr uint64_t keys_per_line = 64 / sizeof(key_type);
+
+    struct alignas(64) line_type
+    {
+        key_type keys[keys_per_line];
+    };
+
+    // Attributes
+    uint64_t n;
+    std::vector<line_type> lines; // Cache line aligned, so that the descendants of k at 16k, ..., 16k + 15 share a line.
+
+
+    // Methods
+    key_type* keys()
+    {
+        return this->lines.data()->keys;
+    }
+
+    const key_type* keys() const
+    {
+        return this->lines.data()->keys;
+    }
+
+    uint64_t build(const array_type& sorted_keys, uint64_t i, const uint64_t& k)
+    {
+        /*
+         * Fills the subtree of index k by an in-order traversal, taking keys from 'sorted_keys'
+         * from position i on. Returns the position of the next key to take.
+         * */
+        if(k <= this->n)
+        {
+            i = build(sorted_keys, i, 2 * k);
+            keys()[k] = sorted_keys[i++];
+            i = build(sorted_keys, i, 2 * k + 1);
+        }
+        return i;
+    }
+
+    uint64_t first_index() const
+    {
+        uint64_t k = this->n == 0 ? 0 : 1;
+        while(k != 0 && 2 * k <= this->n) k = 2 * k;
+        return k;
+    }
+
+    uint64_t next_index(uint64_t k) const
+    {
+        /*
+         * In-order successor of index k, 0 if k holds the largest key.
+         * */
+        if(2 * k + 1 <= this->n)
+        {
+            k = 2 * k + 1;
+            while(2 * k <= this->n) k = 2 * k;
+            return k;
+        }
+        // Up past all the ancestors of which k is in the right subtree, then one more.
+        return k >> (std::countr_one(k) + 1);
+    }
+
+    uint64_t lower_bound_index(const key_type& key) const
+    {
+        /*
+         * Index of the smallest key not less than 'key', 0 if there is none. The descent goes left
+         * or right without a branch, and every turn is recorded in the bits of k. The answer is the
+         * last node where the descent went left, found by dropping the trailing right turns and that
+         * left turn.
+         * */
+        const key_type* tree = keys();
+        uint64_t k = 1;
+        while(k <= this->n)
+        {
+            __builtin_prefetch(tree + k * keys_per_line);
+            k = 2 * k + (tree[k] < key);
+        }
+        return k >> (std::countr_one(k) + 1);
+    }
+
+public:
+
+    class iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = key_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const key_type*;
+        using reference = const key_type&;
+
+        iterator() = default;
+        iterator(const EytzingerSet* set, const uint64_t& k) : set(set), k(k) {}
+
+        reference operator*() const { return this->set->keys()[this->k]; }
+        pointer operator->() const { return &**this; }
+
+        iterator& operator++()
+        {
+            this->k = this->set->next_index(this->k);
+            return *this;
+        }
+        iterator operator++(int)
+        {
+            iterator previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        bool operator==(const iterator& other) const { return this->k == other.k; }
+
+    private:
+        const EytzingerSet* set = nullptr;
+        uint64_t k = 0; // 0 is the end.
+    };
+
+    // Standard un-parametrized C-tor.
+    EytzingerSet() : n(0) {}
+
+    // Methods
+    void insert_keys(const array_type& keys)
+    {
+        /*
+         * Rebuilds the set over its current keys plus 'keys'.
+         */
+        array_type sorted_keys(begin(), end());
+        sorted_keys.insert(sorted_keys.end(), keys.begin(), keys.end());
+        std::sort(sorted_keys.begin(), sorted_keys.end());
+        sorted_keys.erase(std::unique(sorted_keys.begin(), sorted_keys.end()), sorted_keys.end());
+
+        this->n = sorted_keys.size();
+        this->lines.assign((this->n + 1 + keys_per_line - 1) / keys_per_line, line_type{}); // Index 0 is unused.
+        build(sorted_keys, 0, 1);
+    }
+
+    bool holds(const key_type& key) const
+    {
+        const uint64_t k = lower_bound_index(key);
+        return k != 0 && keys()[k] == key;
+    }
+
+    iterator lower_bound(const key_type& key) const
+    {
+        return iterator(this, lower_bound_index(key));
+    }
+
+    iterator begin() const
+    {
+        return iterator(this, first_index());
+    }
+
+    iterator end() const
+    {
+        return iterator(this, 0);
+    }
+
+    uint64_t size() const
+    {
+        return this->n;
+    }
+
+    uint64_t size_in_bytes() const
+    {
+        return sizeof(*this) + this->lines.capacity() * sizeof(line_type);
+    }
+
+};
+
+#endif //PROJECT_1_EYTZINGERSET_HPP
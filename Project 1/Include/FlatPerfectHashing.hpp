@@ -0,0 +1,366 @@
+#ifndef PROJECT_1_FLATPERFECTHASHING_HPP
+#define PROJECT_1_FLATPERFECTHASHING_HPP
+
+#include "Utilities.hpp"
+
+#include <cstring>
+
+#define NR_CACHED_INNER_CONSTS 32
+
+#define PERFECT_HASHING_FILE_MAGIC "RAPHFLAT"
+#define PERFECT_HASHING_FILE_VERSION 1
+#define PERFECT_HASHING_FILE_ALIGNMENT 64
+#define PERFECT_HASHING_FILE_BYTE_ORDER 0x01020304u
+
+
+/*
+ * Header of the on-disk format written by 'FlatPerfectHashing::save'. It is followed by the offsets,
+ * the inner parameters and the slots, each starting at a multiple of PERFECT_HASHING_FILE_ALIGNMENT
+ * bytes, so that a mapped file can be used in place (see 'MappedPerfectHashing').
+ */
+struct perfect_hashing_file_header
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t byte_order;      // Written as PERFECT_HASHING_FILE_BYTE_ORDER, reads differently on a machine of other endianness.
+    uint32_t key_bit_size;
+    uint32_t m, l, a;         // Outer table size and multiply-shift parameters.
+    uint32_t holds_empty_key;
+    uint32_t reserved;
+    uint64_t nr_slots;
+    uint64_t offsets_position, parameters_position, slots_position, file_size;
+};
+
+
+template <typename key_type, typename array_type>
+class FlatPerfectHashing
+{
+private:
+    // Attributes
+    unsigned int m, n;
+
+    key_type l;
+    key_type a;   // Rng. const for functions hashing to entries in outer table.
+
+    unsigned int partition_bits; // log2 of the number of outer bucket ranges handed to build workers.
+
+    // The largest key is used to mark empty slots, so if it is inserted itself it is kept out of the slots.
+    const key_type empty_key = std::numeric_limits<key_type>::max();
+    bool holds_empty_key;
+
+
+    // Methods
+    void initialize_consts(const unsigned int& seed)
+    {
+        this->l = std::log2(this->m); // if m = 2^l then l = log2(m)
+        this->a = get_random_odd_uint32(seed);
+    }
+
+    static uint64_t inner_table_size(const uint64_t& nr_keys)
+    {
+        /*
+         * Square of the number of keys in a bucket rounded up to the nearest power of two,
+         * to enable use of multiply-shift hashing in the inner table.
+         * */
+        if(nr_keys <= 1) return nr_keys;
+        uint64_t size = 1;
+        while(size < nr_keys * nr_keys) size *= 2;
+        return size;
+    }
+
+    unsigned int partition_of(const key_type& key)
+    {
+        /*
+         * Partitions are contiguous ranges of outer buckets, i.e. the top bits of the outer index.
+         * */
+        return hash(key, this->a, this->l) >> (this->l - this->partition_bits);
+    }
+
+    uint64_t partition_keys(const array_type& keys, array_type& partitioned_keys, array_type& partition_offsets,
+                            array_type& counts, const unsigned int& nr_threads)
+    {
+        /*
+         * Stable scatter of the keys into their partitions followed by a histogram of the outer
+         * buckets in each partition. Each worker handles one contiguous chunk of the keys in the
+         * scatter and whole partitions in the histogram, so no two workers write the same entry.
+         * Returns the total size of the inner tables implied by the histogram.
+         * */
+        const unsigned int nr_partitions = 1u << this->partition_bits;
+        const unsigned int buckets_per_partition = this->m >> this->partition_bits;
+        const uint64_t nr_keys = keys.size();
+
+        // Per chunk partition histograms.
+        std::vector<array_type> chunk_counts(nr_threads, array_type(nr_partitions, 0));
+        parallel_for(nr_threads, nr_threads, [&](const unsigned int& chunk)
+        {
+            for(uint64_t i = chunk * nr_keys / nr_threads; i < (chunk + 1) * nr_keys / nr_threads; i++)
+            {
+                chunk_counts[chunk][partition_of(keys[i])]++;
+            }
+        });
+
+        // Prefix sum over (partition, chunk), so chunk c writes right after chunk c-1 within every partition.
+        key_type position = 0;
+        for(unsigned int p = 0; p < nr_partitions; p++)
+        {
+            partition_offsets[p] = position;
+            for(unsigned int chunk = 0; chunk < nr_threads; chunk++)
+            {
+                key_type count = chunk_counts[chunk][p];
+                chunk_counts[chunk][p] = position;
+                position += count;
+            }
+        }
+        partition_offsets[nr_partitions] = position;
+
+        parallel_for(nr_threads, nr_threads, [&](const unsigned int& chunk)
+        {
+            for(uint64_t i = chunk * nr_keys / nr_threads; i < (chunk + 1) * nr_keys / nr_threads; i++)
+            {
+                partitioned_keys[chunk_counts[chunk][partition_of(keys[i])]++] = keys[i];
+            }
+        });
+
+        // Histogram of the outer buckets, one partition at a time.
+        std::vector<uint64_t> partition_sizes(nr_partitions, 0);
+        parallel_for(nr_threads, nr_partitions, [&](const unsigned int& p)
+        {
+            std::fill(counts.begin() + p * buckets_per_partition, counts.begin() + (p + 1) * buckets_per_partition, 0);
+            for(key_type i = partition_offsets[p]; i < partition_offsets[p + 1]; i++)
+            {
+                counts[hash(partitioned_keys[i], this->a, this->l)]++;
+            }
+            for(unsigned int j = p * buckets_per_partition; j < (p + 1) * buckets_per_partition; j++)
+            {
+                partition_sizes[p] += inner_table_size(counts[j]);
+            }
+        });
+
+        uint64_t total_size = 0;
+        for(uint64_t size : partition_sizes) total_size += size;
+        return total_size;
+    }
+
+    key_type inner_hash_const(const unsigned int& attempt, const array_type& cached_consts, const unsigned int& seed)
+    {
+        /*
+         * The candidate constants for the inner tables follow the same seed sequence for every bucket,
+         * so the first few are drawn once up front instead of once per bucket.
+         * */
+        if(attempt < cached_consts.size()) return cached_consts[attempt];
+        unsigned int seed_shift = 1;
+        for(unsigned int i = 0; i < attempt; i++) seed_shift = (seed_shift + 1) * 3;
+        return get_random_odd_uint32(seed + seed_shift * 11);
+    }
+
+    bool fill_inner_table(const key_type* keys, const unsigned int& nr_keys, const unsigned int& bucket)
+    {
+        /*
+         * Writes the keys of 'bucket' straight into its slot range, returns false (and clears the range)
+         * as soon as two different keys collide. Equal keys simply land on the same slot.
+         * */
+        key_type offset = this->offsets[bucket];
+        inner_parameters_type parameters = this->parameters[bucket];
+        for(unsigned int i = 0; i < nr_keys; i++)
+        {
+            key_type& slot = this->slots[offset + hash(keys[i], parameters.a, parameters.l)];
+            if(slot != this->empty_key && slot != keys[i])
+            {
+                std::fill(this->slots.begin() + offset, this->slots.begin() + this->offsets[bucket + 1], this->empty_key);
+                return false;
+            }
+            slot = keys[i];
+        }
+        return true;
+    }
+
+public:
+
+    struct inner_parameters_type
+    {
+        key_type a;
+        key_type l;
+    };
+
+    // Attributes
+    array_type offsets;                                // (m+1) start of each inner table in 'slots'.
+    std::vector<inner_parameters_type> parameters;     // (a_j, l_j) of each inner table.
+    array_type slots;                                  // All inner tables back to back.
+
+    // Parameterized C-tor
+    [[maybe_unused]] explicit FlatPerfectHashing(const unsigned int& n, const unsigned int& seed)
+    {
+        /*
+         * Unlike 'PerfectHashing' only about 2n outer buckets are used, since each outer bucket
+         * now costs an offset and a parameter pair instead of a (mostly empty) vector.
+         * */
+        this->n = n;
+        this->m = 2;
+        while(this->m < 2 * n) this->m *= 2;
+        this->holds_empty_key = false;
+        this->partition_bits = 0;
+        initialize_consts(seed);
+    }
+
+    // Methods
+    void insert_keys(const array_type& keys, const unsigned int& seed, const unsigned int& nr_threads = 1)
+    {
+        /*
+         * Builds the table with 'nr_threads' workers. The outer buckets are split into contiguous
+         * partitions that are processed independently, and every choice of hash constant only depends
+         * on the seed and the keys of a bucket, so the result is bit-identical for any number of threads.
+         * */
+        const unsigned int nr_workers = std::max(1u, nr_threads);
+        this->partition_bits = 0;
+        while(nr_workers > 1 && (1u << this->partition_bits) < 8 * nr_workers && (1u << (this->partition_bits + 1)) <= this->m / 2)
+        {
+            this->partition_bits++;
+        }
+        const unsigned int nr_partitions = 1u << this->partition_bits;
+        const unsigned int buckets_per_partition = this->m >> this->partition_bits;
+
+        /////// ----- Sum of squares should be O(n), redraw outer const until total size <= 4n. ----- ///////
+        array_type partitioned_keys(keys.size());
+        array_type partition_offsets(nr_partitions + 1);
+        array_type counts(this->m);
+        unsigned int seed_shift = 1;
+        while(partition_keys(keys, partitioned_keys, partition_offsets, counts, nr_workers) > 4 * (uint64_t)keys.size() + 4)
+        {
+            this->a = get_random_odd_uint32(seed + seed_shift * 11);
+            seed_shift++;
+        }
+
+        /////// ----- Prefix sums over the partition totals, so every partition knows where it starts. ----- ///////
+        array_type slot_bases(nr_partitions + 1, 0);
+        for(unsigned int p = 0; p < nr_partitions; p++)
+        {
+            slot_bases[p + 1] = slot_bases[p];
+            for(unsigned int j = p * buckets_per_partition; j < (p + 1) * buckets_per_partition; j++) slot_bases[p + 1] += inner_table_size(counts[j]);
+        }
+
+        /////// ----- Grouping keys by outer bucket with a counting sort and laying out the inner tables. ----- ///////
+        array_type group_offsets(this->m + 1);
+        array_type grouped_keys(keys.size());
+        this->offsets.assign(this->m + 1, 0);
+        parallel_for(nr_workers, nr_partitions, [&](const unsigned int& p)
+        {
+            key_type group_offset = partition_offsets[p];
+            key_type slot_offset = slot_bases[p];
+            for(unsigned int j = p * buckets_per_partition; j < (p + 1) * buckets_per_partition; j++)
+            {
+                group_offsets[j] = group_offset;
+                this->offsets[j] = slot_offset;
+                group_offset += counts[j];
+                slot_offset += inner_table_size(counts[j]);
+            }
+            array_type cursors(group_offsets.begin() + p * buckets_per_partition, group_offsets.begin() + (p + 1) * buckets_per_partition);
+            for(key_type i = partition_offsets[p]; i < partition_offsets[p + 1]; i++)
+            {
+                key_type key = partitioned_keys[i];
+                grouped_keys[cursors[hash(key, this->a, this->l) - p * buckets_per_partition]++] = key;
+            }
+        });
+        group_offsets[this->m] = keys.size();
+        this->offsets[this->m] = slot_bases[nr_partitions];
+
+        // One extra empty slot at the end, so an empty last bucket still has a valid slot to compare against.
+        this->slots.assign(this->offsets[this->m] + 1, this->empty_key);
+
+        // Singleton and empty buckets get a = 0, which always hashes to the first slot of the bucket.
+        this->parameters.assign(this->m, {0, 1});
+
+        array_type cached_consts(NR_CACHED_INNER_CONSTS);
+        unsigned int const_seed_shift = 1;
+        for(unsigned int attempt = 0; attempt < NR_CACHED_INNER_CONSTS; attempt++)
+        {
+            cached_consts[attempt] = get_random_odd_uint32(seed + const_seed_shift * 11);
+            const_seed_shift = (const_seed_shift + 1) * 3; // Multiply seed by odd int to avoid getting same a_j even though different seed.
+        }
+
+        /////// ----- Making sure that there are no collisions in inner tables. ----- ///////
+        parallel_for(nr_workers, nr_partitions, [&](const unsigned int& p)
+        {
+            for(unsigned int j = p * buckets_per_partition; j < (p + 1) * buckets_per_partition; j++)
+            {
+                if(counts[j] == 0) continue;
+                if(counts[j] > 1)
+                {
+                    this->parameters[j].l = std::log2(this->offsets[j + 1] - this->offsets[j]);
+                    unsigned int attempt = 0;
+                    do
+                    {
+                        this->parameters[j].a = inner_hash_const(attempt, cached_consts, seed);
+                        attempt++;
+                    } while(!fill_inner_table(&grouped_keys[group_offsets[j]], counts[j], j));
+                }
+                else fill_inner_table(&grouped_keys[group_offsets[j]], 1, j);
+            }
+        });
+
+        // The marker value itself is answered from a flag instead of the slots.
+        this->holds_empty_key = std::find(keys.begin(), keys.end(), this->empty_key) != keys.end();
+    }
+
+    bool holds(const key_type& key) const
+    {
+        /*
+         * Checks whether the provided key is stored in the hash table.
+         * The offset and the parameters of the outer bucket are independent loads,
+         * followed by a single load of the candidate slot.
+         */
+        if(key == this->empty_key) return this->holds_empty_key;
+
+        key_type outer_index = hash(key, this->a, this->l);
+        const inner_parameters_type& inner_parameters = this->parameters[outer_index];
+        return this->slots[this->offsets[outer_index] + hash(key, inner_parameters.a, inner_parameters.l)] == key;
+    }
+
+    uint64_t size_in_bytes() const
+    {
+        return sizeof(*this)
+             + this->offsets.capacity() * sizeof(key_type)
+             + this->parameters.capacity() * sizeof(inner_parameters_type)
+             + this->slots.capacity() * sizeof(key_type);
+    }
+
+    void save(const std::string& filename) const
+    {
+        /*
+         * Writes the table in the versioned binary format described by 'perfect_hashing_file_header'.
+         * */
+        auto aligned = [](uint64_t position) {
+            return (position + PERFECT_HASHING_FILE_ALIGNMENT - 1) / PERFECT_HASHING_FILE_ALIGNMENT * PERFECT_HASHING_FILE_ALIGNMENT;
+        };
+
+        perfect_hashing_file_header header{};
+        std::memcpy(header.magic, PERFECT_HASHING_FILE_MAGIC, sizeof(header.magic));
+        header.version = PERFECT_HASHING_FILE_VERSION;
+        header.byte_order = PERFECT_HASHING_FILE_BYTE_ORDER;
+        header.key_bit_size = CHAR_BIT * sizeof(key_type);
+        header.m = this->m;
+        header.l = this->l;
+        header.a = this->a;
+        header.holds_empty_key = this->holds_empty_key;
+        header.nr_slots = this->slots.size();
+        header.offsets_position = aligned(sizeof(header));
+        header.parameters_position = aligned(header.offsets_position + this->offsets.size() * sizeof(key_type));
+        header.slots_position = aligned(header.parameters_position + this->parameters.size() * sizeof(inner_parameters_type));
+        header.file_size = header.slots_position + this->slots.size() * sizeof(key_type);
+
+        std::ofstream output_stream(filename, std::ofstream::binary | std::ofstream::trunc);
+        if(!output_stream) throw std::runtime_error("Could not open '" + filename + "' for writing.");
+
+        auto write_at = [&output_stream](uint64_t position, const void* data, uint64_t nr_bytes) {
+            while((uint64_t)output_stream.tellp() < position) output_stream.put(0); // Zero padding up to the aligned position.
+            output_stream.write(reinterpret_cast<const char*>(data), (std::streamsize)nr_bytes);
+        };
+        write_at(0, &header, sizeof(header));
+        write_at(header.offsets_position, this->offsets.data(), this->offsets.size() * sizeof(key_type));
+        write_at(header.parameters_position, this->parameters.data(), this->parameters.size() * sizeof(inner_parameters_type));
+        write_at(header.slots_position, this->slots.data(), this->slots.size() * sizeof(key_type));
+        if(!output_stream) throw std::runtime_error("Could not write perfect hashing table to '" + filename + "'.");
+    }
+
+};
+
+#endif //PROJECT_1_FLATPERFECTHASHING_HPP
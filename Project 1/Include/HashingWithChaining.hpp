@@ -3,6 +3,13 @@
 //
 
 #include "Utilities.hpp"
+#include "InterleavedLookup.hpp"
+#include "ArenaAllocator.hpp"
+
+#include <bit>
+
+// Number of old buckets moved to the grown table per insert or query while a migration runs.
+#define HWC_MIGRATION_STEP 2
 
 
 template <typename key_type, typename array_type, typename list_type>
@@ -12,17 +19,56 @@ private:
     using hash_table_type = std::vector<list_type>;
 
     // Attributes
-    unsigned int m;
+    unsigned int m, nr_keys;
 
     key_type a, l;
 
+    double max_load_factor;
+
+    // With an arena allocator the table owns the arena, and every list gets a copy of an allocator that
+    // only points to it. Declared before the lists, so the arena outlives them.
+    std::shared_ptr<node_arena> arena;
+    typename list_type::allocator_type allocator = allocator_for<typename list_type::allocator_type>(this->arena);
+
+    // While growing, the buckets of the previous table that are not moved yet. Buckets below 'migrated' are empty,
+    // and the grown table only holds the 2 * migrated buckets they were split into. Once all are moved, the
+    // emptied buckets are destroyed from the back, so 'old_table' may then be shorter than 'migrated'.
+    hash_table_type old_table;
+    unsigned int migrated;
+
 
     // Methods
+    static bool bucket_holds(const list_type& bucket, const key_type& key)
+    {
+        /*
+         * Buckets that can search themselves (e.g. 'InlineBucket') do so, lists are scanned.
+         * */
+        if constexpr (requires { bucket.contains(key); }) return bucket.contains(key);
+        else return std::find(bucket.begin(), bucket.end(), key) != bucket.end();
+    }
+
+    lookup_task chain_lookup(const key_type key)
+    {
+        /*
+         * Coroutine form of 'holds' that prefetches the bucket and every node of the chain
+         * before touching it, and suspends in between. The key is taken by value as the
+         * coroutine outlives the caller's argument.
+         * */
+        const list_type& bucket = this->hash_table[hash(key, this->a, this->l)];
+        co_await prefetch_and_suspend{&bucket};
+        if constexpr (requires { bucket.contains(key); }) co_return bucket.contains(key); // The keys are in the bucket itself.
+        for(auto iterator = bucket.begin(); iterator != bucket.end(); ++iterator)
+        {
+            co_await prefetch_and_suspend{&*iterator};
+            if(*iterator == key) co_return true;
+        }
+        co_return false;
+    }
+
     void initialize_hash_table()
     {
         hash_table.reserve(this->m);    // allocate memory for the array/vector
-        hash_table.resize(this->m);        // initialize the array/vector with the given size
-        for(key_type i = 0; i < this->m; i++) hash_table[i] = std::list<key_type>{}; // Setting lists in array/vector.
+        hash_table.assign(this->m, list_type(this->allocator)); // Setting lists in array/vector.
     }
 
     void initialize_consts(const unsigned int& seed)
@@ -37,15 +83,85 @@ private:
         this->l = std::log2(this->m); // if m = 2^l then l = log2(m)
     }
 
+    bool is_migrating()
+    {
+        return this->migrated < this->old_table.size();
+    }
+
+    list_type& bucket_of(const key_type& key)
+    {
+        /*
+         * The grown table keeps 'a' and uses one more bit of the hash value, so old bucket i
+         * splits into new buckets 2i and 2i+1. Whether a key has moved yet therefore only
+         * depends on whether its old bucket is below 'migrated'.
+         * */
+        key_type index = hash(key, this->a, this->l);
+        if(is_migrating() && (index >> 1) >= this->migrated) return this->old_table[index >> 1];
+        return this->hash_table[index];
+    }
+
+    void migrate_buckets(unsigned int nr_buckets)
+    {
+        /*
+         * Moves the next 'nr_buckets' buckets of the old table over, appending the two buckets each
+         * of them splits into to the grown table. List nodes are spliced, not copied, so no key is
+         * allocated or moved in memory. When all are moved, destroys the next 'nr_buckets' emptied
+         * old buckets instead, and frees the old table when none is left.
+         * */
+        for(; nr_buckets > 0 && this->migrated < this->old_table.size(); nr_buckets--, this->migrated++)
+        {
+            this->hash_table.push_back(list_type(this->allocator));
+            this->hash_table.push_back(list_type(this->allocator));
+            list_type& old_bucket = this->old_table[this->migrated];
+            if constexpr (requires { old_bucket.splice(old_bucket.end(), old_bucket, old_bucket.begin()); })
+            {
+                while(!old_bucket.empty())
+                {
+                    list_type& new_bucket = this->hash_table[hash(old_bucket.front(), this->a, this->l)];
+                    new_bucket.splice(new_bucket.end(), old_bucket, old_bucket.begin());
+                }
+            }
+            else
+            {
+                // Buckets without nodes, like 'InlineBucket', have their keys copied instead.
+                for(key_type key : old_bucket) this->hash_table[hash(key, this->a, this->l)].push_back(key);
+                old_bucket.clear();
+            }
+        }
+        for(; nr_buckets > 0 && !this->old_table.empty(); nr_buckets--) this->old_table.pop_back();
+        if(this->old_table.empty() && this->old_table.capacity() > 0) hash_table_type().swap(this->old_table);
+    }
+
+    void grow()
+    {
+        /*
+         * Doubles the number of buckets. Only memory for the grown table is reserved here, its
+         * buckets are created and the keys moved HWC_MIGRATION_STEP old buckets at a time by the
+         * following operations, so no single insertion pays for a full rehash.
+         * */
+        while(!this->old_table.empty()) migrate_buckets(this->old_table.size()); // Only happens for very low max load factors.
+
+        this->l++;
+        this->m = 1u << this->l;
+        this->old_table = std::move(this->hash_table);
+        this->hash_table = hash_table_type();
+        this->hash_table.reserve(this->m);
+        this->migrated = 0;
+    }
+
 public:
 
     // Attributes
     hash_table_type hash_table;
 
     // Parameterized C-tor
-    [[maybe_unused]] explicit HashingWithChaining(const unsigned int& n, const unsigned int& seed)
+    [[maybe_unused]] explicit HashingWithChaining(const unsigned int& n, const unsigned int& seed, const double& max_load_factor = 1.0)
     {
-     this->m = n;
+     if(max_load_factor <= 0.0) throw std::runtime_error("Max load factor given to HashingWithChaining C-tor should be positive.");
+     this->m = std::max(std::bit_ceil(n), 2u); // Growing splits every bucket in two, so all 2^l must be addressable, and l = 0 would make the hash function shift by 32.
+     this->nr_keys = 0;
+     this->max_load_factor = max_load_factor;
+     this->migrated = 0;
      initialize_hash_table();
      initialize_consts(seed);
     }
@@ -53,7 +169,10 @@ public:
     // Methods
     void insert(const key_type& key)
     {
-        this->hash_table[hash(key, this->a, this->l)].push_back(std::move(key));
+        if(!this->old_table.empty()) migrate_buckets(HWC_MIGRATION_STEP);
+        if((double)(this->nr_keys + 1) > this->max_load_factor * this->m) grow();
+        bucket_of(key).push_back(key);
+        this->nr_keys++;
     }
 
     void insert_keys(const array_type& keys)
@@ -66,28 +185,83 @@ public:
         /*
          * Checks whether the provided key is stored in the hash table.
          */
-        key_type index = hash(key, this->a, this->l);
+        if(!this->old_table.empty()) migrate_buckets(HWC_MIGRATION_STEP);
+        list_type& bucket = bucket_of(key);
 
         // Only start iterating through linked list if bucket is not empty
-        if(!this->hash_table[index].empty())
+        return !bucket.empty() && bucket_holds(bucket, key);
+    }
+    void holds_batch(std::span<const key_type> keys, std::span<uint8_t> out)
+    {
+        /*
+         * Same as calling 'holds' for every key, but HOLDS_BATCH_SIZE keys at a time in stages:
+         * first all buckets are hashed and prefetched, then the first node of every non-empty
+         * chain is prefetched, and only then are the chains searched. The cache misses of a
+         * group thereby overlap instead of being paid one after the other.
+         */
+        if(is_migrating())
         {
-            auto iterator = std::find(this->hash_table[index].begin(), this->hash_table[index].end(), key);
-            if(iterator != this->hash_table[index].end())
+            // Keys may sit in either table until the migration is done.
+            for(std::size_t i = 0; i < keys.size(); i++) out[i] = holds(keys[i]);
+            return;
+        }
+
+        key_type indices[HOLDS_BATCH_SIZE];
+        for(std::size_t group_start = 0; group_start < keys.size(); group_start += HOLDS_BATCH_SIZE)
+        {
+            const std::size_t group_size = std::min<std::size_t>(HOLDS_BATCH_SIZE, keys.size() - group_start);
+
+            for(std::size_t i = 0; i < group_size; i++)
             {
-                return true;
+                indices[i] = hash(keys[group_start + i], this->a, this->l);
+                __builtin_prefetch(&this->hash_table[indices[i]]);
+            }
+            for(std::size_t i = 0; i < group_size; i++)
+            {
+                if(!this->hash_table[indices[i]].empty()) __builtin_prefetch(&this->hash_table[indices[i]].front());
+            }
+            for(std::size_t i = 0; i < group_size; i++)
+            {
+                const list_type& bucket = this->hash_table[indices[i]];
+                out[group_start + i] = bucket_holds(bucket, keys[group_start + i]);
             }
         }
-        return false;
     }
+
+    std::vector<uint8_t> holds_interleaved(std::span<const key_type> keys, const unsigned int& group_size)
+    {
+        /*
+         * Same as calling 'holds' for every key, but with 'group_size' lookups in flight that
+         * are resumed round-robin, so every step down a chain overlaps with the steps of the
+         * other lookups. Unlike 'holds_batch' this also hides the misses beyond the first node.
+         */
+        if(is_migrating())
+        {
+            std::vector<uint8_t> results(keys.size());
+            for(std::size_t i = 0; i < keys.size(); i++) results[i] = holds(keys[i]);
+            return results;
+        }
+        return interleave_lookups(keys, group_size, [this](const key_type& key) { return chain_lookup(key); });
+    }
+
     unsigned int max_bucket_size()
     {
         unsigned int max_size = 0;
-        for(int m_i = 0; m_i < this->m; m_i++)
+        for(const list_type& bucket : this->hash_table)
+        {
+            if(bucket.size() > max_size) max_size = bucket.size();
+        }
+        for(const list_type& bucket : this->old_table)
         {
-            if(this->hash_table[m_i].size() > max_size) max_size = this->hash_table[m_i].size();
+            if(bucket.size() > max_size) max_size = bucket.size();
         }
         return max_size;
     }
 
+    double load_factor()
+    {
+        return (double)this->nr_keys / this->m;
+    }
+
 
 };
\ No newline at end of file
@@ -0,0 +1,150 @@
+#ifndef PROJECT_1_INLINEBUCKET_HPP
+#define PROJECT_1_INLINEBUCKET_HPP
+
+#include "Utilities.hpp"
+
+#include <bit>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+
+/*
+ * Bucket for 'HashingWithChaining' (as its 'list_type') that keeps the first K keys inline, i.e. in
+ * the bucket array itself, and only spills further keys to a vector. With K = 8 and 32-bit keys a
+ * bucket is exactly one cache line, so a lookup in a bucket of at most 8 keys is one memory access
+ * and one SIMD comparison, instead of a walk over list nodes scattered over the heap.
+ */
+template <typename key_type, unsigned int K>
+class alignas(64) InlineBucket
+{
+public:
+    using value_type = key_type;
+    using allocator_type = std::allocator<key_type>;
+
+    class iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = key_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const key_type*;
+        using reference = const key_type&;
+
+        iterator() = default;
+        iterator(const InlineBucket* bucket, const unsigned int& position) : bucket(bucket), position(position) {}
+
+        reference operator*() const
+        {
+            return this->position < K ? this->bucket->keys[this->position] : this->bucket->overflow[this->position - K];
+        }
+        pointer operator->() const { return &**this; }
+
+        iterator& operator++()
+        {
+            this->position++;
+            return *this;
+        }
+        iterator operator++(int)
+        {
+            iterator previous = *this;
+            this->position++;
+            return previous;
+        }
+
+        bool operator==(const iterator& other) const { return this->position == other.position; }
+
+    private:
+        const InlineBucket* bucket = nullptr;
+        unsigned int position = 0;
+    };
+    using const_iterator = iterator;
+
+private:
+    // Attributes
+    key_type keys[K];
+    unsigned int nr_keys;
+    std::vector<key_type> overflow;
+
+
+    // Methods
+    uint32_t match_inline(const key_type& key) const
+    {
+        /*
+         * Bit i of the returned mask is set if inline slot i holds 'key'. Slots beyond 'nr_keys'
+         * may hold stale keys, so the caller has to mask them out.
+         * */
+        uint32_t mask = 0;
+        unsigned int slot = 0;
+        if constexpr (sizeof(key_type) == 4)
+        {
+#if defined(__AVX2__)
+            const __m256i query = _mm256_set1_epi32((int)key);
+            for(; slot + 8 <= K; slot += 8)
+            {
+                __m256i equal = _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(this->keys + slot)), query);
+                mask |= (uint32_t)_mm256_movemask_ps(_mm256_castsi256_ps(equal)) << slot;
+            }
+#endif
+#if defined(__AVX2__) || defined(__SSE2__)
+            const __m128i query_128 = _mm_set1_epi32((int)key);
+            for(; slot + 4 <= K; slot += 4)
+            {
+                __m128i equal = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(this->keys + slot)), query_128);
+                mask |= (uint32_t)_mm_movemask_ps(_mm_castsi128_ps(equal)) << slot;
+            }
+#endif
+        }
+        for(; slot < K; slot++)
+        {
+            if(this->keys[slot] == key) mask |= (1u << slot);
+        }
+        return mask;
+    }
+
+public:
+
+    // Standard un-parametrized C-tor.
+    InlineBucket() : keys{}, nr_keys(0) {}
+
+    // Allocator C-tor, as 'HashingWithChaining' builds its buckets from its allocator.
+    explicit InlineBucket(const allocator_type&) : InlineBucket() {}
+
+    // Methods
+    void push_back(const key_type& key)
+    {
+        if(this->nr_keys < K) this->keys[this->nr_keys] = key;
+        else this->overflow.push_back(key);
+        this->nr_keys++;
+    }
+
+    bool contains(const key_type& key) const
+    {
+        /*
+         * Compares all inline keys at once, and only scans the overflow vector if the bucket spilled.
+         */
+        static_assert(K <= 32, "Inline keys of an InlineBucket are matched in a 32-bit mask.");
+        const uint32_t valid = this->nr_keys >= K ? (uint32_t)((1ull << K) - 1) : (1u << this->nr_keys) - 1;
+        if((match_inline(key) & valid) != 0) return true;
+        if(this->nr_keys <= K) return false;
+        return std::find(this->overflow.begin(), this->overflow.end(), key) != this->overflow.end();
+    }
+
+    void clear()
+    {
+        this->nr_keys = 0;
+        this->overflow.clear();
+    }
+
+    bool empty() const { return this->nr_keys == 0; }
+    std::size_t size() const { return this->nr_keys; }
+    const key_type& front() const { return this->keys[0]; }
+
+    iterator begin() const { return iterator(this, 0); }
+    iterator end() const { return iterator(this, this->nr_keys); }
+};
+
+#endif //PROJECT_1_INLINEBUCKET_HPP
@@ -0,0 +1,161 @@
+#ifndef PROJECT_1_INTERLEAVEDLOOKUP_HPP
+#define PROJECT_1_INTERLEAVEDLOOKUP_HPP
+
+#include "Utilities.hpp"
+
+#include <coroutine>
+#include <utility>
+
+
+/*
+ * Engine for interleaving lookups in pointer-chasing structures. A lookup is written as a C++20
+ * coroutine that prefetches the next node it is going to read and suspends ('co_await
+ * prefetch_and_suspend{address}'). 'interleave_lookups' keeps a group of such lookups in flight
+ * and resumes them round-robin, so while one lookup waits for its node to arrive from memory
+ * the others make progress.
+ */
+class lookup_task
+{
+public:
+    struct promise_type
+    {
+        bool result = false;
+
+        lookup_task get_return_object() { return lookup_task(std::coroutine_handle<promise_type>::from_promise(*this)); }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_always final_suspend() noexcept { return {}; }
+        void return_value(const bool& value) { this->result = value; }
+        void unhandled_exception() { std::terminate(); }
+
+        // Frames of finished lookups are recycled, so a lookup does not cost a heap allocation.
+        static void* operator new(std::size_t size)
+        {
+            frame_pool& pool = get_frame_pool();
+            if(pool.frame_size == size && !pool.free_frames.empty())
+            {
+                void* frame = pool.free_frames.back();
+                pool.free_frames.pop_back();
+                return frame;
+            }
+            return ::operator new(size);
+        }
+
+        static void operator delete(void* frame, std::size_t size)
+        {
+            frame_pool& pool = get_frame_pool();
+            if(pool.free_frames.empty()) pool.frame_size = size;
+            if(pool.frame_size == size) pool.free_frames.push_back(frame);
+            else ::operator delete(frame);
+        }
+    };
+
+    explicit lookup_task(std::coroutine_handle<promise_type> handle) : handle(handle) {}
+
+    lookup_task(lookup_task&& other) noexcept : handle(std::exchange(other.handle, nullptr)) {}
+
+    lookup_task& operator=(lookup_task&& other) noexcept
+    {
+        if(this != &other)
+        {
+            if(this->handle) this->handle.destroy();
+            this->handle = std::exchange(other.handle, nullptr);
+        }
+        return *this;
+    }
+
+    lookup_task(const lookup_task&) = delete;
+    lookup_task& operator=(const lookup_task&) = delete;
+
+    ~lookup_task()
+    {
+        if(this->handle) this->handle.destroy();
+    }
+
+    bool done() const { return this->handle.done(); }
+    void resume() { this->handle.resume(); }
+    bool result() const { return this->handle.promise().result; }
+
+private:
+    struct frame_pool
+    {
+        std::size_t frame_size = 0;
+        std::vector<void*> free_frames;
+
+        ~frame_pool()
+        {
+            for(void* frame : this->free_frames) ::operator delete(frame);
+        }
+    };
+
+    static frame_pool& get_frame_pool()
+    {
+        thread_local frame_pool pool;
+        return pool;
+    }
+
+    std::coroutine_handle<promise_type> handle;
+};
+
+
+struct prefetch_and_suspend
+{
+    const void* address;
+
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(std::coroutine_handle<>) const noexcept { __builtin_prefetch(this->address); }
+    void await_resume() const noexcept {}
+};
+
+
+template <typename array_type, typename task_factory_type>
+std::vector<uint8_t> interleave_lookups(const array_type& keys, const unsigned int& group_size, task_factory_type make_task)
+{
+    /*
+     * Runs make_task(key) for every key with at most 'group_size' lookups in flight at once,
+     * and returns their results in the order of the keys.
+     */
+    std::vector<uint8_t> results(keys.size());
+    std::vector<lookup_task> tasks;
+    std::vector<std::size_t> task_keys;
+    tasks.reserve(group_size);
+    task_keys.reserve(group_size);
+
+    std::size_t next_key = 0;
+    while(next_key < keys.size() && tasks.size() < std::max(1u, group_size))
+    {
+        tasks.push_back(make_task(keys[next_key]));
+        task_keys.push_back(next_key++);
+    }
+
+    while(!tasks.empty())
+    {
+        for(std::size_t i = 0; i < tasks.size(); )
+        {
+            tasks[i].resume();
+            if(!tasks[i].done())
+            {
+                i++;
+                continue;
+            }
+
+            results[task_keys[i]] = tasks[i].result();
+            if(next_key < keys.size())
+            {
+                // The slot is refilled with the next key, which gets resumed in the following round.
+                tasks[i] = make_task(keys[next_key]);
+                task_keys[i] = next_key++;
+                i++;
+            }
+            else
+            {
+                tasks[i] = std::move(tasks.back());
+                task_keys[i] = task_keys.back();
+                tasks.pop_back();
+                task_keys.pop_back();
+            }
+        }
+    }
+    return results;
+}
+
+#endif //PROJECT_1_INTERLEAVEDLOOKUP_HPP
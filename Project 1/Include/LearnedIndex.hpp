@@ -0,0 +1,205 @@
+#ifndef PROJECT_1_LEARNEDINDEX_HPP
+#define PROJECT_1_LEARNEDINDEX_HPP
+
+#include "Utilities.hpp"
+
+#define LEARNED_INDEX_KEYS_PER_MODEL 256 // Keys per second stage model on average.
+
+
+/*
+ * Static ordered set as a two-stage recursive model index (Kraska et al.) over the sorted keys.
+ * A root linear model maps a key to one of ~n / 256 leaf linear models, and the leaf model predicts
+ * the position of the key in the sorted array. Every leaf model records how far below and above its
+ * predictions the positions of its keys are, so a lookup is two multiply-adds and a binary search
+ * of that window only. For keys such as 'generate_ordered_keys' the models are exact and the window
+ * is a single key, against the log2(n) pointer chases of a std::set.
+ *
+ * A key that is absent may fall outside the window of the leaf model it maps to, 'lower_bound' then
+ * continues with an exponential search from the window's edge.
+ *
+ * Built once by 'insert_keys', then only queried. Iteration is a walk over the sorted keys.
+ */
+template <typename key_type, typename array_type>
+class LearnedIndex
+{
+private:
+    struct model_type
+    {
+        double slope = 0, intercept = 0;
+        uint32_t error_below = 0, error_above = 0; // Largest distance of a position below resp. above its prediction.
+    };
+
+    // Attributes
+    array_type keys;
+    model_type root;
+    std::vector<model_type> models;
+
+
+    // Methods
+    static model_type fit(const array_type& xs, const uint64_t& start, const uint64_t& end, const double& y_start, const double& y_step)
+    {
+        /*
+         * Least squares line through (xs[i], y_start + (i - start) y_step) for i in [start, end).
+         * Centered on the first key, so the sums stay small.
+         * */
+        model_type model;
+        const uint64_t count = end - start;
+        if(count == 0) return model;
+        model.intercept = y_start;
+        if(count == 1) return model;
+
+        const double x_0 = xs[start];
+        double mean_x = 0, mean_y = 0;
+        for(uint64_t i = start; i < end; i++)
+        {
+            mean_x += xs[i] - x_0;
+            mean_y += (i - start) * y_step;
+        }
+        mean_x /= count;
+        mean_y /= count;
+        double covariance = 0, variance = 0;
+        for(uint64_t i = start; i < end; i++)
+        {
+            const double dx = xs[i] - x_0 - mean_x;
+            covariance += dx * ((i - start) * y_step - mean_y);
+            variance += dx * dx;
+        }
+        model.slope = variance == 0 ? 0 : covariance / variance;
+        model.intercept = y_start + mean_y - model.slope * (mean_x + x_0);
+        return model;
+    }
+
+    static double predict(const model_type& model, const key_type& key)
+    {
+        return model.slope * key + model.intercept;
+    }
+
+    uint64_t model_of(const key_type& key) const
+    {
+        const double prediction = predict(this->root, key);
+        if(prediction <= 0) return 0;
+        return std::min<uint64_t>(prediction, this->models.size() - 1);
+    }
+
+    uint64_t position_of(const model_type& model, const key_type& key) const
+    {
+        const double prediction = predict(model, key);
+        if(prediction <= 0) return 0;
+        return std::min<uint64_t>(prediction, this->keys.size());
+    }
+
+    uint64_t lower_bound_index(const key_type& key) const
+    {
+        /*
+         * Position of the smallest key not less than 'key', 'n' if there is none. A binary search
+         * of the window of the leaf model, which holds the position if 'key' is one of the keys of
+         * that model. Otherwise the position is just outside, and the search goes on exponentially
+         * from the edge of the window.
+         * */
+        const uint64_t n = this->keys.size();
+        if(n == 0) return 0;
+        const model_type& model = this->models[model_of(key)];
+        const uint64_t position = position_of(model, key);
+        uint64_t low = position > model.error_below ? position - model.error_below : 0;
+        uint64_t high = std::min<uint64_t>(position + model.error_above + 1, n);
+
+        if(low > 0 && key <= this->keys[low - 1])
+        {
+            // Doubling steps to the left, until a key less than 'key' is passed.
+            uint64_t step = 1;
+            high = low;
+            while(step < low && key <= this->keys[low - step]) step *= 2;
+            low = step < low ? low - step : 0;
+        }
+        else if(high < n && this->keys[high - 1] < key)
+        {
+            // Doubling steps to the right, until a key not less than 'key' is reached.
+            uint64_t step = 1;
+            low = high;
+            while(high + step < n && this->keys[high + step - 1] < key) step *= 2;
+            high = std::min(high + step, n);
+        }
+        return std::lower_bound(this->keys.begin() + low, this->keys.begin() + high, key) - this->keys.begin();
+    }
+
+public:
+
+    using iterator = typename array_type::const_iterator;
+
+    // Standard un-parametrized C-tor.
+    LearnedIndex() = default;
+
+    // Methods
+    void insert_keys(const array_type& keys)
+    {
+        /*
+         * Rebuilds the index over its current keys plus 'keys'.
+         */
+        this->keys.insert(this->keys.end(), keys.begin(), keys.end());
+        std::sort(this->keys.begin(), this->keys.end());
+        this->keys.erase(std::unique(this->keys.begin(), this->keys.end()), this->keys.end());
+        const uint64_t n = this->keys.size();
+
+        // The root model maps the keys evenly over the leaf models, by their rank.
+        const uint64_t nr_models = std::max<uint64_t>(1, n / LEARNED_INDEX_KEYS_PER_MODEL);
+        this->root = fit(this->keys, 0, n, 0, (double)nr_models / std::max<uint64_t>(n, 1));
+        this->models.assign(nr_models, model_type());
+
+        // The root model is non-decreasing, so the keys of every leaf model are a range of the array.
+        uint64_t start = 0;
+        for(uint64_t j = 0; j < nr_models; j++)
+        {
+            uint64_t end = start;
+            while(end < n && model_of(this->keys[end]) == j) end++;
+            model_type& model = this->models[j];
+            model = fit(this->keys, start, end, start, 1);
+            for(uint64_t i = start; i < end; i++)
+            {
+                const uint64_t position = position_of(model, this->keys[i]);
+                if(position > i) model.error_below = std::max<uint64_t>(model.error_below, position - i);
+                else model.error_above = std::max<uint64_t>(model.error_above, i - position);
+            }
+            start = end;
+        }
+    }
+
+    bool holds(const key_type& key) const
+    {
+        const uint64_t i = lower_bound_index(key);
+        return i < this->keys.size() && this->keys[i] == key;
+    }
+
+    iterator lower_bound(const key_type& key) const
+    {
+        return this->keys.begin() + lower_bound_index(key);
+    }
+
+    iterator begin() const
+    {
+        return this->keys.begin();
+    }
+
+    iterator end() const
+    {
+        return this->keys.end();
+    }
+
+    uint64_t size() const
+    {
+        return this->keys.size();
+    }
+
+    uint64_t model_size_in_bytes() const
+    {
+        // The root and leaf models, i.e. the index on top of the sorted keys.
+        return sizeof(model_type) + this->models.capacity() * sizeof(model_type);
+    }
+
+    uint64_t size_in_bytes() const
+    {
+        return sizeof(*this) + this->keys.capacity() * sizeof(key_type) + this->models.capacity() * sizeof(model_type);
+    }
+
+};
+
+#endif //PROJECT_1_LEARNEDINDEX_HPP
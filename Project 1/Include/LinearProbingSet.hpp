@@ -0,0 +1,203 @@
+#ifndef PROJECT_1_LINEARPROBINGSET_HPP
+#define PROJECT_1_LINEARPROBINGSET_HPP
+
+#include "Utilities.hpp"
+
+
+template <typename key_type, typename array_type>
+class LinearProbingSet
+{
+private:
+    using slot_array_type = std::vector<key_type>;
+
+    // Attributes
+    unsigned int m, nr_keys;
+
+    key_type a, l;
+
+    double max_load_factor;
+
+    // The largest key is used to mark empty slots, so if it is inserted itself it is kept out of the array.
+    const key_type empty_key = std::numeric_limits<key_type>::max();
+    bool holds_empty_key;
+
+
+    // Methods
+    void initialize_slots()
+    {
+        this->slots.assign(this->m, this->empty_key); // One contiguous array, every slot marked empty.
+    }
+
+    void initialize_consts(const unsigned int& seed)
+    {
+        /*
+         * Initializing constants for hash function here
+         * to avoid continuous recalculation when
+         * calling hash function.
+         * */
+
+        this->a = get_random_odd_uint32(seed);
+        this->l = std::log2(this->m); // if m = 2^l then l = log2(m)
+    }
+
+    unsigned int smallest_capacity(const unsigned int& n)
+    {
+        /*
+         * Smallest power of two (at least 2, so that l > 0 in the multiply-shift)
+         * that can hold 'n' keys without exceeding the max load factor.
+         * */
+        unsigned int capacity = 2;
+        while((double)n > this->max_load_factor * capacity) capacity *= 2;
+        return capacity;
+    }
+
+    unsigned int distance_from_home(const unsigned int& slot)
+    {
+        return (slot - hash(this->slots[slot], this->a, this->l)) & (this->m - 1);
+    }
+
+    void place(const key_type& key)
+    {
+        /*
+         * Puts 'key' in the first empty slot starting from its home slot.
+         * Assumes that the key is not already stored and that there is room.
+         * */
+        unsigned int slot = hash(key, this->a, this->l);
+        while(this->slots[slot] != this->empty_key) slot = (slot + 1) & (this->m - 1);
+        this->slots[slot] = key;
+    }
+
+    void grow()
+    {
+        /*
+         * Doubles the number of slots. With multiply-shift the same constant 'a' can
+         * be kept; the home slot of each key just gains one more bit.
+         * */
+        slot_array_type old_slots = std::move(this->slots);
+        this->m *= 2;
+        this->l += 1;
+        initialize_slots();
+        for(key_type key : old_slots)
+        {
+            if(key != this->empty_key) place(key);
+        }
+    }
+
+public:
+
+    // Attributes
+    slot_array_type slots;
+
+    // Parameterized C-tor
+    [[maybe_unused]] explicit LinearProbingSet(const unsigned int& n, const unsigned int& seed, const double& max_load_factor = 0.5)
+    {
+        if(max_load_factor <= 0.0 || max_load_factor >= 1.0) throw std::runtime_error("Max load factor given to LinearProbingSet C-tor should be in (0,1).");
+        this->max_load_factor = max_load_factor;
+        this->nr_keys = 0;
+        this->holds_empty_key = false;
+        this->m = smallest_capacity(n);
+        initialize_slots();
+        initialize_consts(seed);
+    }
+
+    // Methods
+    void insert(const key_type& key)
+    {
+        if(key == this->empty_key)
+        {
+            this->holds_empty_key = true;
+            return;
+        }
+        if(holds(key)) return; // Set semantics, i.e. no duplicates.
+
+        if((double)(this->nr_keys + 1) > this->max_load_factor * this->m) grow();
+        place(key);
+        this->nr_keys++;
+    }
+
+    void insert_keys(const array_type& keys)
+    {
+        for(key_type key : keys) insert(key);
+    }
+
+    bool holds(const key_type& key)
+    {
+        /*
+         * Checks whether the provided key is stored in the hash table.
+         * The run starting at the home slot is scanned until the key or an empty slot is met.
+         */
+        if(key == this->empty_key) return this->holds_empty_key;
+
+        unsigned int slot = hash(key, this->a, this->l);
+        while(this->slots[slot] != this->empty_key)
+        {
+            if(this->slots[slot] == key) return true;
+            slot = (slot + 1) & (this->m - 1);
+        }
+        return false;
+    }
+
+    bool remove(const key_type& key)
+    {
+        /*
+         * Removes the provided key (if present) without leaving a tombstone. The keys following
+         * the freed slot in the same run are shifted backwards whenever their home slot allows it,
+         * so that every remaining key is still reachable from its home slot without gaps.
+         */
+        if(key == this->empty_key)
+        {
+            bool was_held = this->holds_empty_key;
+            this->holds_empty_key = false;
+            return was_held;
+        }
+
+        unsigned int hole = hash(key, this->a, this->l);
+        while(this->slots[hole] != key)
+        {
+            if(this->slots[hole] == this->empty_key) return false;
+            hole = (hole + 1) & (this->m - 1);
+        }
+
+        unsigned int slot = hole;
+        while(true)
+        {
+            slot = (slot + 1) & (this->m - 1);
+            if(this->slots[slot] == this->empty_key) break;
+
+            // A key may only move back into the hole if the hole lies between its home slot and its current slot.
+            if(distance_from_home(slot) >= ((slot - hole) & (this->m - 1)))
+            {
+                this->slots[hole] = this->slots[slot];
+                hole = slot;
+            }
+        }
+        this->slots[hole] = this->empty_key;
+        this->nr_keys--;
+        return true;
+    }
+
+    unsigned int max_probe_length()
+    {
+        /*
+         * Largest number of slots inspected by a successful query,
+         * i.e. the counterpart of 'max_bucket_size' in hashing with chaining.
+         */
+        unsigned int max_length = 0;
+        for(unsigned int slot = 0; slot < this->m; slot++)
+        {
+            if(this->slots[slot] != this->empty_key && distance_from_home(slot) + 1 > max_length)
+            {
+                max_length = distance_from_home(slot) + 1;
+            }
+        }
+        return max_length;
+    }
+
+    double load_factor()
+    {
+        return (double)this->nr_keys / this->m;
+    }
+
+};
+
+#endif //PROJECT_1_LINEARPROBINGSET_HPP
@@ -0,0 +1,157 @@
+#ifndef PROJECT_1_MAPPEDPERFECTHASHING_HPP
+#define PROJECT_1_MAPPEDPERFECTHASHING_HPP
+
+#include "Utilities.hpp"
+#include "FlatPerfectHashing.hpp"
+
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+template <typename key_type>
+class MappedPerfectHashing
+{
+private:
+    using inner_parameters_type = typename FlatPerfectHashing<key_type, std::vector<key_type>>::inner_parameters_type;
+
+    // Attributes
+    const key_type empty_key = std::numeric_limits<key_type>::max();
+
+    void* mapping;
+    uint64_t mapping_size;
+
+    // Views into the mapped pages, nothing is copied.
+    const perfect_hashing_file_header* header;
+    const key_type* offsets;
+    const inner_parameters_type* parameters;
+    const key_type* slots;
+
+
+    // Methods
+    void validate_header(const std::string& filename)
+    {
+        /*
+         * Rejects files that are not written by 'FlatPerfectHashing::save' with the same
+         * version, key size and byte order, or whose sections do not fit in the file.
+         * */
+        if(this->mapping_size < sizeof(perfect_hashing_file_header)) throw std::runtime_error("'" + filename + "' is too small to be a perfect hashing table.");
+        const perfect_hashing_file_header& file_header = *this->header;
+
+        if(std::memcmp(file_header.magic, PERFECT_HASHING_FILE_MAGIC, sizeof(file_header.magic)) != 0) throw std::runtime_error("'" + filename + "' is not a perfect hashing table.");
+        if(file_header.version != PERFECT_HASHING_FILE_VERSION) throw std::runtime_error("'" + filename + "' has unsupported version " + std::to_string(file_header.version) + ".");
+        if(file_header.byte_order != PERFECT_HASHING_FILE_BYTE_ORDER) throw std::runtime_error("'" + filename + "' was written on a machine with different byte order.");
+        if(file_header.key_bit_size != CHAR_BIT * sizeof(key_type)) throw std::runtime_error("'" + filename + "' holds keys of a different bit size.");
+        if(file_header.m < 2 || (file_header.m & (file_header.m - 1)) != 0 || (1ull << file_header.l) != file_header.m) throw std::runtime_error("'" + filename + "' has an invalid outer table size.");
+
+        const bool aligned = file_header.offsets_position % PERFECT_HASHING_FILE_ALIGNMENT == 0
+                          && file_header.parameters_position % PERFECT_HASHING_FILE_ALIGNMENT == 0
+                          && file_header.slots_position % PERFECT_HASHING_FILE_ALIGNMENT == 0;
+        const bool fits = file_header.offsets_position + (file_header.m + 1ull) * sizeof(key_type) <= file_header.parameters_position
+                       && file_header.parameters_position + (uint64_t)file_header.m * sizeof(inner_parameters_type) <= file_header.slots_position
+                       && file_header.slots_position + file_header.nr_slots * sizeof(key_type) <= file_header.file_size
+                       && file_header.file_size <= this->mapping_size;
+        if(!aligned || !fits) throw std::runtime_error("'" + filename + "' has corrupt section positions.");
+    }
+
+    void validate_sections(const std::string& filename)
+    {
+        /*
+         * Rejects offsets and inner parameters that would make 'holds' read outside the slots:
+         * the offsets must start at 0, never decrease and end one slot before the last (the
+         * extra empty slot), and every inner table must have room for all its hash values.
+         * Reads the offsets and parameters once, i.e. pages them in.
+         * */
+        const uint64_t m = this->header->m;
+        bool valid = this->offsets[0] == 0 && this->offsets[m] + 1ull == this->header->nr_slots;
+        for(uint64_t j = 0; j < m && valid; j++)
+        {
+            const inner_parameters_type& inner_parameters = this->parameters[j];
+            valid = this->offsets[j] <= this->offsets[j + 1]
+                 && inner_parameters.l >= 1 && inner_parameters.l <= KEY_BIT_SIZE
+                 && (inner_parameters.a == 0 || (1ull << inner_parameters.l) <= (uint64_t)this->offsets[j + 1] - this->offsets[j]);
+        }
+        if(!valid) throw std::runtime_error("'" + filename + "' has corrupt offsets or inner tables.");
+    }
+
+    void unmap()
+    {
+        if(this->mapping != nullptr) munmap(this->mapping, this->mapping_size);
+        this->mapping = nullptr;
+    }
+
+public:
+
+    // Parameterized C-tor
+    [[maybe_unused]] explicit MappedPerfectHashing(const std::string& filename)
+    {
+        /*
+         * Maps the file read-only and shared, so loading costs no more than paging in what the
+         * queries touch, and several processes mapping the same file share the page cache copy.
+         * */
+        int file_descriptor = open(filename.c_str(), O_RDONLY);
+        if(file_descriptor == -1) throw std::runtime_error("Could not open '" + filename + "'.");
+
+        struct stat file_status{};
+        if(fstat(file_descriptor, &file_status) == -1)
+        {
+            close(file_descriptor);
+            throw std::runtime_error("Could not stat '" + filename + "'.");
+        }
+        this->mapping_size = file_status.st_size;
+        this->mapping = mmap(nullptr, this->mapping_size, PROT_READ, MAP_SHARED, file_descriptor, 0);
+        close(file_descriptor); // The mapping stays valid after the descriptor is closed.
+        if(this->mapping == MAP_FAILED)
+        {
+            this->mapping = nullptr;
+            throw std::runtime_error("Could not map '" + filename + "'.");
+        }
+
+        const char* base = static_cast<const char*>(this->mapping);
+        this->header = reinterpret_cast<const perfect_hashing_file_header*>(base);
+        try
+        {
+            validate_header(filename);
+            this->offsets = reinterpret_cast<const key_type*>(base + this->header->offsets_position);
+            this->parameters = reinterpret_cast<const inner_parameters_type*>(base + this->header->parameters_position);
+            this->slots = reinterpret_cast<const key_type*>(base + this->header->slots_position);
+            validate_sections(filename);
+        }
+        catch(...)
+        {
+            unmap();
+            throw;
+        }
+    }
+
+    MappedPerfectHashing(const MappedPerfectHashing&) = delete;
+    MappedPerfectHashing& operator=(const MappedPerfectHashing&) = delete;
+
+    ~MappedPerfectHashing()
+    {
+        unmap();
+    }
+
+    // Methods
+    bool holds(const key_type& key) const
+    {
+        /*
+         * Same lookup as 'FlatPerfectHashing::holds', answered straight from the mapped pages.
+         */
+        if(key == this->empty_key) return this->header->holds_empty_key != 0;
+
+        key_type outer_index = hash(key, this->header->a, this->header->l);
+        const inner_parameters_type& inner_parameters = this->parameters[outer_index];
+        return this->slots[this->offsets[outer_index] + hash(key, inner_parameters.a, inner_parameters.l)] == key;
+    }
+
+    uint64_t size_in_bytes() const
+    {
+        return this->mapping_size;
+    }
+
+};
+
+#endif //PROJECT_1_MAPPEDPERFECTHASHING_HPP
@@ -0,0 +1,247 @@
+#ifndef PROJECT_1_MINIMALPERFECTHASHING_HPP
+#define PROJECT_1_MINIMALPERFECTHASHING_HPP
+
+#include "Utilities.hpp"
+#include "CompactVector.hpp"
+
+#include <bit>
+
+#define MPHF_PARTITION_SIZE (1 << 16)   // Keys per partition on average, partitions are built independently.
+#define MPHF_BUCKET_CONST 4.0           // A partition of n keys gets MPHF_BUCKET_CONST * n / log2(n) buckets.
+#define MPHF_LOAD_FACTOR 0.99           // Keys per slot, the free slots below n are filled by remapping.
+#define MPHF_MAX_PILOT (1ull << 24)     // A search past this pilot restarts the build with another seed.
+
+
+/*
+ * Minimal perfect hash function in the style of PTHash (Pibiri and Trani), i.e. 'index_of' maps the
+ * n keys it was built for bijectively to [0, n), and values can be kept in a dense array on the side.
+ * The keys themselves are not stored, so 'index_of' of any other key is some index in [0, n).
+ *
+ * The keys are split into partitions that are built independently (and in parallel). Within a
+ * partition of n_p keys, every key falls into one of ~4 n_p / log2(n_p) buckets, skewed such that
+ * 60% of the keys share 30% of the buckets. Buckets are placed largest first: for each, the smallest
+ * pilot p is searched for which all its keys land in free slots at fastrange(h(h(key) ^ p), m), with
+ * m = n_p / 0.99 slots. A lookup is thereby two hashes and one pilot read. The slots of keys beyond
+ * n_p are remapped to the free slots below n_p. Pilots and remapped slots are stored in compact
+ * vectors of just enough bits.
+ *
+ * N.B. the keys are mixed with SplitMix64 rather than multiply-shift hashed, see 'XorFilter': for
+ * consecutive keys, multiply-shift values are too regular for the pilot search.
+ */
+template <typename key_type, typename array_type>
+class MinimalPerfectHashing
+{
+private:
+    struct partition_type
+    {
+        uint64_t offset;           // Index of the first key of the partition.
+        uint64_t nr_keys, nr_slots, nr_buckets, nr_dense_buckets;
+        CompactVector pilots;
+        CompactVector free_slots;  // Slot below nr_keys for every slot from nr_keys on.
+    };
+
+    // Attributes
+    unsigned int seed, seed_shift;
+    uint64_t hash_seed;
+    uint64_t nr_keys;
+
+
+    // Methods
+    static uint64_t mix(const uint64_t& x)
+    {
+        return XoshiroCpp::SplitMix64(x)();
+    }
+
+    static uint64_t fastrange_32(const uint32_t& x, const uint64_t& range)
+    {
+        return ((uint64_t)x * range) >> 32;
+    }
+
+    static uint64_t fastrange_64(const uint64_t& x, const uint64_t& range)
+    {
+        return (uint64_t)(((unsigned __int128)x * range) >> 64);
+    }
+
+    uint64_t hash_64(const key_type& key) const
+    {
+        // The high half picks the partition, the low half whether the key goes to a dense bucket.
+        return mix(this->hash_seed + key);
+    }
+
+    static uint64_t bucket_of(const uint64_t& key_hash, const uint64_t& position_hash, const partition_type& partition)
+    {
+        // 60% of the keys go to the first 30% of the buckets.
+        if((uint32_t)key_hash < (uint32_t)(0.6 * UINT32_MAX)) return fastrange_32((uint32_t)position_hash, partition.nr_dense_buckets);
+        return partition.nr_dense_buckets + fastrange_32((uint32_t)position_hash, partition.nr_buckets - partition.nr_dense_buckets);
+    }
+
+    static uint64_t slot_of(const uint64_t& position_hash, const uint64_t& pilot, const partition_type& partition)
+    {
+        // Mixed after the pilot is applied: with few slots, fastrange of 'position_hash ^ mix(pilot)'
+        // would only see the top bits, and two keys agreeing on those would collide for every pilot.
+        return fastrange_64(mix(position_hash ^ pilot), partition.nr_slots);
+    }
+
+    bool build_partition(partition_type& partition, const std::vector<uint64_t>& key_hashes)
+    {
+        /*
+         * Finds the pilots of one partition. Returns false if some bucket needs an unreasonably
+         * large pilot, which happens if two of its keys have the same position hash.
+         * */
+        const uint64_t n = key_hashes.size();
+        partition.nr_keys = n;
+        partition.nr_slots = std::max<uint64_t>(n, std::ceil(n / MPHF_LOAD_FACTOR));
+        partition.nr_buckets = std::max<uint64_t>(2, std::ceil(MPHF_BUCKET_CONST * n / std::max(std::log2((double)n), 1.0)));
+        partition.nr_dense_buckets = std::max<uint64_t>(1, 0.3 * partition.nr_buckets);
+
+        // Position hashes grouped by bucket (counting sort).
+        std::vector<uint64_t> position_hashes(n), bucket_starts(partition.nr_buckets + 1, 0), buckets(n);
+        for(uint64_t i = 0; i < n; i++)
+        {
+            position_hashes[i] = mix(key_hashes[i]);
+            buckets[i] = bucket_of(key_hashes[i], position_hashes[i], partition);
+            bucket_starts[buckets[i] + 1]++;
+        }
+        std::partial_sum(bucket_starts.begin(), bucket_starts.end(), bucket_starts.begin());
+        std::vector<uint64_t> grouped_hashes(n), fill = bucket_starts;
+        for(uint64_t i = 0; i < n; i++) grouped_hashes[fill[buckets[i]]++] = position_hashes[i];
+
+        // Buckets largest first, the order among buckets of one size does not matter.
+        std::vector<uint64_t> bucket_order(partition.nr_buckets);
+        std::iota(bucket_order.begin(), bucket_order.end(), 0);
+        std::stable_sort(bucket_order.begin(), bucket_order.end(), [&](const uint64_t& a, const uint64_t& b)
+        {
+            return bucket_starts[a + 1] - bucket_starts[a] > bucket_starts[b + 1] - bucket_starts[b];
+        });
+
+        std::vector<bool> taken(partition.nr_slots, false);
+        std::vector<uint64_t> pilots(partition.nr_buckets, 0);
+        for(uint64_t bucket : bucket_order)
+        {
+            const uint64_t start = bucket_starts[bucket], end = bucket_starts[bucket + 1];
+            if(start == end) break; // Only empty buckets are left.
+            for(uint64_t pilot = 0; ; pilot++)
+            {
+                if(pilot >= MPHF_MAX_PILOT) return false;
+                uint64_t i = start;
+                for(; i < end; i++)
+                {
+                    const uint64_t slot = slot_of(grouped_hashes[i], pilot, partition);
+                    if(taken[slot]) break;
+                    taken[slot] = true;
+                }
+                if(i == end)
+                {
+                    pilots[bucket] = pilot;
+                    break;
+                }
+                // A collision, the slots taken for this pilot are freed again.
+                for(uint64_t j = start; j < i; j++) taken[slot_of(grouped_hashes[j], pilot, partition)] = false;
+            }
+        }
+
+        partition.pilots = CompactVector(partition.nr_buckets, CompactVector::width_of(*std::max_element(pilots.begin(), pilots.end())));
+        for(uint64_t bucket = 0; bucket < partition.nr_buckets; bucket++) partition.pilots.set(bucket, pilots[bucket]);
+
+        // Taken slots from n on are paired, in order, with the free slots below n.
+        partition.free_slots = CompactVector(partition.nr_slots - n, CompactVector::width_of(n));
+        uint64_t free_slot = 0;
+        for(uint64_t slot = n; slot < partition.nr_slots; slot++)
+        {
+            if(!taken[slot]) continue;
+            while(taken[free_slot]) free_slot++;
+            partition.free_slots.set(slot - n, free_slot++);
+        }
+        return true;
+    }
+
+public:
+
+    // Attributes
+    std::vector<partition_type> partitions;
+
+    // Parameterized C-tor
+    [[maybe_unused]] explicit MinimalPerfectHashing(const unsigned int& n, const unsigned int& seed)
+    {
+        this->seed = seed;
+        this->seed_shift = 0;
+        this->nr_keys = 0;
+        this->hash_seed = 0;
+        this->partitions.resize(std::max<uint64_t>(1, (n + MPHF_PARTITION_SIZE - 1) / MPHF_PARTITION_SIZE));
+    }
+
+    // Methods
+    void insert_keys(const array_type& keys, const unsigned int& nr_threads = 1)
+    {
+        /*
+         * Builds the function for 'keys', with the partitions spread over 'nr_threads' threads.
+         * Replaces whatever the function was built for before. Duplicate keys are ignored, as they
+         * would collide for every pilot, so 'size' is the number of distinct keys.
+         */
+        array_type unique_keys = keys;
+        std::sort(unique_keys.begin(), unique_keys.end());
+        unique_keys.erase(std::unique(unique_keys.begin(), unique_keys.end()), unique_keys.end());
+        this->nr_keys = unique_keys.size();
+        this->partitions.resize(std::max<uint64_t>(1, (this->nr_keys + MPHF_PARTITION_SIZE - 1) / MPHF_PARTITION_SIZE));
+        const uint64_t nr_partitions = this->partitions.size();
+
+        bool built = false;
+        while(!built)
+        {
+            this->hash_seed = ((uint64_t)get_random_uint32(this->seed + this->seed_shift * 11) << 32) | get_random_uint32(this->seed + this->seed_shift * 11 + 1);
+            this->seed_shift++;
+
+            std::vector<std::vector<uint64_t>> partition_hashes(nr_partitions);
+            for(auto& hashes : partition_hashes) hashes.reserve(this->nr_keys / nr_partitions + this->nr_keys / nr_partitions / 8 + 1);
+            for(key_type key : unique_keys)
+            {
+                const uint64_t key_hash = hash_64(key);
+                partition_hashes[fastrange_32(key_hash >> 32, nr_partitions)].push_back(key_hash);
+            }
+            uint64_t offset = 0;
+            for(uint64_t p = 0; p < nr_partitions; p++)
+            {
+                this->partitions[p].offset = offset;
+                offset += partition_hashes[p].size();
+            }
+
+            std::atomic<bool> failed = false;
+            parallel_for(nr_threads, nr_partitions, [&](const unsigned int& p)
+            {
+                if(!build_partition(this->partitions[p], partition_hashes[p])) failed = true;
+            });
+            built = !failed;
+        }
+    }
+
+    uint64_t index_of(const key_type& key) const
+    {
+        /*
+         * Index in [0, n) of the key, distinct for the keys the function was built for.
+         */
+        const uint64_t key_hash = hash_64(key);
+        const partition_type& partition = this->partitions[fastrange_32(key_hash >> 32, this->partitions.size())];
+        if(partition.nr_keys == 0) return partition.offset;
+        const uint64_t position_hash = mix(key_hash);
+        const uint64_t slot = slot_of(position_hash, partition.pilots.get(bucket_of(key_hash, position_hash, partition)), partition);
+        return partition.offset + (slot < partition.nr_keys ? slot : partition.free_slots.get(slot - partition.nr_keys));
+    }
+
+    uint64_t size() const
+    {
+        return this->nr_keys;
+    }
+
+    uint64_t size_in_bytes() const
+    {
+        uint64_t total_size = sizeof(*this) + this->partitions.capacity() * sizeof(partition_type);
+        for(const partition_type& partition : this->partitions)
+        {
+            total_size += partition.pilots.size_in_bytes() + partition.free_slots.size_in_bytes() - 2 * sizeof(CompactVector);
+        }
+        return total_size;
+    }
+
+};
+
+#endif //PROJECT_1_MINIMALPERFECTHASHING_HPP
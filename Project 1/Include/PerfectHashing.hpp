@@ -253,8 +253,74 @@ public:
             }
 
         }
-        if(m_j == 1) return true;
+        // A single list holds the only key of the bucket, which still has to be compared to the query.
+        if(m_j == 1) return (this->outer_table[outer_index])[0].front() == key;
         return false;
     }
 
+    void holds_batch(std::span<const key_type> keys, std::span<uint8_t> out)
+    {
+        /*
+         * Same as calling 'holds' for every key, but HOLDS_BATCH_SIZE keys at a time in stages:
+         * hash and prefetch the outer entries, then compute the inner indices and prefetch the
+         * inner lists, then prefetch the first list nodes, and only then compare. The dependent
+         * cache misses of a group thereby overlap instead of being paid one after the other.
+         */
+        key_type outer_indices[HOLDS_BATCH_SIZE];
+        const list_type* inner_lists[HOLDS_BATCH_SIZE];
+        for(std::size_t group_start = 0; group_start < keys.size(); group_start += HOLDS_BATCH_SIZE)
+        {
+            const std::size_t group_size = std::min<std::size_t>(HOLDS_BATCH_SIZE, keys.size() - group_start);
+
+            for(std::size_t i = 0; i < group_size; i++)
+            {
+                outer_indices[i] = hash(keys[group_start + i], this->a, this->l);
+                __builtin_prefetch(&this->outer_table[outer_indices[i]]);
+                __builtin_prefetch(&this->A[outer_indices[i]]);
+            }
+            for(std::size_t i = 0; i < group_size; i++)
+            {
+                const inner_hash_table_type& inner_table = this->outer_table[outer_indices[i]];
+                inner_lists[i] = nullptr;
+                if(inner_table.size() == 1) inner_lists[i] = &inner_table[0];
+                else if(inner_table.size() > 1)
+                {
+                    key_type l_j = std::log2(inner_table.size());
+                    inner_lists[i] = &inner_table[hash(keys[group_start + i], this->A[outer_indices[i]], l_j)];
+                }
+                if(inner_lists[i] != nullptr) __builtin_prefetch(inner_lists[i]);
+            }
+            for(std::size_t i = 0; i < group_size; i++)
+            {
+                if(inner_lists[i] != nullptr && !inner_lists[i]->empty()) __builtin_prefetch(&inner_lists[i]->front());
+            }
+            for(std::size_t i = 0; i < group_size; i++)
+            {
+                out[group_start + i] = inner_lists[i] != nullptr
+                                    && std::find(inner_lists[i]->begin(), inner_lists[i]->end(), keys[group_start + i]) != inner_lists[i]->end();
+            }
+        }
+    }
+
+    uint64_t size_in_bytes()
+    {
+        /*
+         * Estimate of the memory held by the structure: the storage of all vectors plus
+         * one list node (two pointers and the key) per key stored in a list.
+         */
+        const uint64_t node_size = 2 * sizeof(void*) + sizeof(key_type);
+        uint64_t total_size = sizeof(*this)
+                            + this->outer_table.capacity() * sizeof(inner_hash_table_type)
+                            + this->A.capacity() * sizeof(key_type)
+                            + this->outer_collisions.capacity() * sizeof(list_type)
+                            + this->outer_collisions_vector.size() * sizeof(key_type);
+        for(const inner_hash_table_type& inner_table : this->outer_table)
+        {
+            total_size += inner_table.capacity() * sizeof(list_type);
+            for(const list_type& linked_list : inner_table) total_size += linked_list.size() * node_size;
+        }
+        for(const list_type& linked_list : this->outer_collisions) total_size += linked_list.size() * node_size;
+        return total_size;
+    }
+
 };
\ No newline at end of file
@@ -3,11 +3,49 @@
 //
 
 #include "Utilities.hpp"
+#include "InterleavedLookup.hpp"
 
 
 template <typename key_type, typename array_type>
 class RedBlackTree {
 
+private:
+    // The keys of 'tree' in Eytzinger (BFS) order, index 0 unused: the root at 1 and the children of k at 2k and 2k + 1.
+    // std::set offers no portable way to step through its nodes, so the interleaved lookups descend this implicit
+    // tree instead. Rebuilt by the first interleaved lookup after an insert.
+    std::vector<key_type> eytzinger_keys;
+    bool eytzinger_keys_current = false;
+
+    void fill_eytzinger_keys(typename std::set<key_type>::const_iterator& iterator, const uint64_t& k)
+    {
+        /*
+         * Fills the subtree of index k by an in-order traversal, taking the keys of 'tree' from 'iterator' on.
+         * */
+        if(k < this->eytzinger_keys.size())
+        {
+            fill_eytzinger_keys(iterator, 2 * k);
+            this->eytzinger_keys[k] = *iterator++;
+            fill_eytzinger_keys(iterator, 2 * k + 1);
+        }
+    }
+
+    lookup_task eytzinger_lookup(const key_type key) const
+    {
+        /*
+         * Coroutine form of 'holds' on 'eytzinger_keys', which prefetches every node of the descent and
+         * suspends before reading it. The key is taken by value as the coroutine outlives the caller's argument.
+         * */
+        uint64_t k = 1;
+        while(k < this->eytzinger_keys.size())
+        {
+            co_await prefetch_and_suspend{&this->eytzinger_keys[k]};
+            const key_type& node_key = this->eytzinger_keys[k];
+            if(node_key == key) co_return true;
+            k = 2 * k + (node_key < key);
+        }
+        co_return false;
+    }
+
 public:
     // Attributes
     std::set<key_type> tree;
@@ -15,11 +53,12 @@ public:
     // Standard un-parametrized C-tor.
     RedBlackTree() {};
 
-    void insert(key_type& key) {
+    void insert(const key_type& key) {
         this->tree.insert(key);
+        this->eytzinger_keys_current = false;
     }
 
-    void insert_keys(array_type& keys){
+    void insert_keys(const array_type& keys){
         for(auto key: keys) insert(key);
     }
 
@@ -31,4 +70,39 @@ public:
         return false;
     }
 
+    typename std::set<key_type>::const_iterator lower_bound(const key_type& key) const {
+        return this->tree.lower_bound(key);
+    }
+
+    typename std::set<key_type>::const_iterator begin() const {
+        return this->tree.begin();
+    }
+
+    typename std::set<key_type>::const_iterator end() const {
+        return this->tree.end();
+    }
+
+    uint64_t size_in_bytes() const {
+        /*
+         * Estimate of the memory held by the tree: one node (color, three pointers and the key)
+         * per key.
+         */
+        const uint64_t node_size = sizeof(int) + 3 * sizeof(void*) + sizeof(key_type);
+        return sizeof(*this) + this->tree.size() * node_size + this->eytzinger_keys.capacity() * sizeof(key_type);
+    }
+
+    std::vector<uint8_t> holds_interleaved(std::span<const key_type> keys, const unsigned int& group_size){
+        /*
+         * Same as calling 'holds' for every key, with 'group_size' descents of the Eytzinger ordered keys in flight.
+         */
+        if(!this->eytzinger_keys_current)
+        {
+            this->eytzinger_keys.assign(this->tree.size() + 1, 0);
+            auto iterator = this->tree.cbegin();
+            fill_eytzinger_keys(iterator, 1);
+            this->eytzinger_keys_current = true;
+        }
+        return interleave_lookups(keys, group_size, [this](const key_type& key) { return eytzinger_lookup(key); });
+    }
+
 };
\ No newline at end of file
@@ -0,0 +1,210 @@
+#ifndef PROJECT_1_ROBINHOODSET_HPP
+#define PROJECT_1_ROBINHOODSET_HPP
+
+#include "Utilities.hpp"
+
+
+template <typename key_type, typename array_type>
+class RobinHoodSet
+{
+private:
+    using slot_array_type = std::vector<key_type>;
+    using probe_length_type = uint8_t;
+    using probe_length_array_type = std::vector<probe_length_type>;
+
+    // Attributes
+    unsigned int m, nr_keys;
+
+    key_type a, l;
+
+    double max_load_factor;
+
+    // Probe sequence lengths are stored as distance + 1, such that 0 marks an empty slot.
+    const probe_length_type max_probe_length_value = std::numeric_limits<probe_length_type>::max();
+
+
+    // Methods
+    void initialize_slots()
+    {
+        this->slots.assign(this->m, 0);
+        this->probe_lengths.assign(this->m, 0);
+    }
+
+    void initialize_consts(const unsigned int& seed)
+    {
+        /*
+         * Initializing constants for hash function here
+         * to avoid continuous recalculation when
+         * calling hash function.
+         * */
+
+        this->a = get_random_odd_uint32(seed);
+        this->l = std::log2(this->m); // if m = 2^l then l = log2(m)
+    }
+
+    unsigned int smallest_capacity(const unsigned int& n)
+    {
+        /*
+         * Smallest power of two (at least 2, so that l > 0 in the multiply-shift)
+         * that can hold 'n' keys without exceeding the max load factor.
+         * */
+        unsigned int capacity = 2;
+        while((double)n > this->max_load_factor * capacity) capacity *= 2;
+        return capacity;
+    }
+
+    void place(key_type key)
+    {
+        /*
+         * Robin Hood insertion: walking from the home slot, the key takes the slot of any
+         * key that is closer to its own home ("richer"), which then continues the walk.
+         * Assumes that the key is not already stored and that there is room.
+         * */
+        unsigned int slot = hash(key, this->a, this->l);
+        probe_length_type probe_length = 1;
+        while(this->probe_lengths[slot] != 0)
+        {
+            if(this->probe_lengths[slot] < probe_length)
+            {
+                std::swap(key, this->slots[slot]);
+                std::swap(probe_length, this->probe_lengths[slot]);
+            }
+            slot = (slot + 1) & (this->m - 1);
+
+            // The metadata can not represent longer probe sequences, so the table is grown before
+            // the walk would store 'max_probe_length_value', which 'holds' and 'remove' could not step past.
+            if(probe_length == this->max_probe_length_value - 1)
+            {
+                grow();
+                place(key);
+                return;
+            }
+            probe_length++;
+        }
+        this->slots[slot] = key;
+        this->probe_lengths[slot] = probe_length;
+    }
+
+    void grow()
+    {
+        /*
+         * Doubles the number of slots. With multiply-shift the same constant 'a' can
+         * be kept; the home slot of each key just gains one more bit.
+         * */
+        slot_array_type old_slots = std::move(this->slots);
+        probe_length_array_type old_probe_lengths = std::move(this->probe_lengths);
+        this->m *= 2;
+        this->l += 1;
+        initialize_slots();
+        for(unsigned int slot = 0; slot < old_slots.size(); slot++)
+        {
+            if(old_probe_lengths[slot] != 0) place(old_slots[slot]);
+        }
+    }
+
+public:
+
+    // Attributes
+    slot_array_type slots;
+    probe_length_array_type probe_lengths;
+
+    // Parameterized C-tor
+    [[maybe_unused]] explicit RobinHoodSet(const unsigned int& n, const unsigned int& seed, const double& max_load_factor = 0.9)
+    {
+        if(max_load_factor <= 0.0 || max_load_factor >= 1.0) throw std::runtime_error("Max load factor given to RobinHoodSet C-tor should be in (0,1).");
+        this->max_load_factor = max_load_factor;
+        this->nr_keys = 0;
+        this->m = smallest_capacity(n);
+        initialize_slots();
+        initialize_consts(seed);
+    }
+
+    // Methods
+    void insert(const key_type& key)
+    {
+        if(holds(key)) return; // Set semantics, i.e. no duplicates.
+
+        if((double)(this->nr_keys + 1) > this->max_load_factor * this->m) grow();
+        place(key);
+        this->nr_keys++;
+    }
+
+    void insert_keys(const array_type& keys)
+    {
+        for(key_type key : keys) insert(key);
+    }
+
+    bool holds(const key_type& key)
+    {
+        /*
+         * Checks whether the provided key is stored in the hash table.
+         * Keys along a run are ordered by decreasing distance to home, so the
+         * search stops as soon as it meets a slot whose key is richer than the
+         * query would be at that position (this includes empty slots).
+         */
+        unsigned int slot = hash(key, this->a, this->l);
+        unsigned int probe_length = 1; // Wider than the stored lengths, so it can not wrap around.
+        while(this->probe_lengths[slot] >= probe_length)
+        {
+            if(this->slots[slot] == key) return true;
+            slot = (slot + 1) & (this->m - 1);
+            probe_length++;
+        }
+        return false;
+    }
+
+    bool remove(const key_type& key)
+    {
+        /*
+         * Removes the provided key (if present) by backward shift: every following key that is
+         * not in its home slot is moved one slot back, so no tombstones are needed.
+         */
+        unsigned int slot = hash(key, this->a, this->l);
+        unsigned int probe_length = 1;
+        while(this->probe_lengths[slot] >= probe_length && this->slots[slot] != key)
+        {
+            slot = (slot + 1) & (this->m - 1);
+            probe_length++;
+        }
+        if(this->probe_lengths[slot] < probe_length) return false;
+
+        unsigned int next = (slot + 1) & (this->m - 1);
+        while(this->probe_lengths[next] > 1)
+        {
+            this->slots[slot] = this->slots[next];
+            this->probe_lengths[slot] = this->probe_lengths[next] - 1;
+            slot = next;
+            next = (next + 1) & (this->m - 1);
+        }
+        this->probe_lengths[slot] = 0;
+        this->nr_keys--;
+        return true;
+    }
+
+    unsigned int max_probe_length()
+    {
+        /*
+         * Largest number of slots inspected by a successful query.
+         */
+        return *std::max_element(this->probe_lengths.begin(), this->probe_lengths.end());
+    }
+
+    double average_probe_length()
+    {
+        /*
+         * Average number of slots inspected by a successful query.
+         */
+        if(this->nr_keys == 0) return 0.0;
+        double total = 0.0;
+        for(probe_length_type probe_length : this->probe_lengths) total += probe_length;
+        return total / this->nr_keys;
+    }
+
+    double load_factor()
+    {
+        return (double)this->nr_keys / this->m;
+    }
+
+};
+
+#endif //PROJECT_1_ROBINHOODSET_HPP
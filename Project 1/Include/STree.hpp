@@ -0,0 +1,169 @@
+#ifndef PROJECT_1_STREE_HPP
+#define PROJECT_1_STREE_HPP
+
+#include "Utilities.hpp"
+
+#include <bit>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#define STREE_NODE_SIZE 16 // Keys per node, one cache line of 4-byte keys.
+
+
+/*
+ * Static ordered set as an implicit B+ tree with 16 keys per node and 17 children per internal node
+ * (the S+ tree of Algorithmica). The leaves are the sorted keys in nodes of 16, padded with the
+ * largest key. Each internal node holds, for its children 1, ..., 16, the smallest key below that
+ * child. Layers are stored one after the other, and the children of node k of a layer are nodes
+ * 17k, ..., 17k + 16 of the layer below, so there are no pointers. Searching a node is counting its
+ * keys less than the query, with AVX2 two compares of 8 keys and a popcount. A search reads one
+ * cache line per level, i.e. log_17(n / 16) + 1 lines instead of the log_2(n) nodes of a std::set.
+ *
+ * Built once by 'insert_keys', then only queried. The leaves hold the keys in order, so iteration
+ * is a walk over an array.
+ */
+template <typename key_type, typename array_type>
+class STree
+{
+private:
+    static constexpr uint64_t nr_children = STREE_NODE_SIZE + 1;
+    static constexpr key_type padding_key = std::numeric_limits<key_type>::max();
+
+    struct alignas(64) node_type
+    {
+        key_type keys[STREE_NODE_SIZE];
+    };
+
+    static_assert(sizeof(node_type) == STREE_NODE_SIZE * sizeof(key_type), "The leaves of an STree must form one contiguous array of keys.");
+
+    // Attributes
+    uint64_t n;
+    std::vector<node_type> nodes;
+    std::vector<uint64_t> layer_offsets; // Index of the first node of every layer, the leaves being layer 0.
+
+
+    // Methods
+    static unsigned int rank(const node_type& node, const key_type& key)
+    {
+        /*
+         * Number of keys of the node less than 'key'.
+         * */
+#if defined(__AVX2__)
+        if constexpr (sizeof(key_type) == 4 && STREE_NODE_SIZE == 16)
+        {
+            // AVX2 compares signed integers, flipping the top bit makes that an unsigned comparison.
+            const __m256i sign = _mm256_set1_epi32(std::is_signed_v<key_type> ? 0 : (int)0x80000000);
+            const __m256i query = _mm256_xor_si256(_mm256_set1_epi32((int)key), sign);
+            const __m256i low = _mm256_xor_si256(_mm256_load_si256(reinterpret_cast<const __m256i*>(node.keys)), sign);
+            const __m256i high = _mm256_xor_si256(_mm256_load_si256(reinterpret_cast<const __m256i*>(node.keys + 8)), sign);
+            const uint32_t less_low = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(query, low)));
+            const uint32_t less_high = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(query, high)));
+            return std::popcount(less_low | (less_high << 8));
+        }
+#endif
+        unsigned int count = 0;
+        for(unsigned int i = 0; i < STREE_NODE_SIZE; i++) count += node.keys[i] < key;
+        return count;
+    }
+
+    uint64_t lower_bound_index(const key_type& key) const
+    {
+        /*
+         * Position in the sorted keys of the smallest key not less than 'key', 'n' if there is
+         * none. The child taken in each internal node is the one after the separators below
+         * 'key'. If all the keys of the leaf reached are less than 'key', the answer is the first
+         * key of the next leaf, which the position then points to already.
+         * */
+        if(this->n == 0) return 0;
+        uint64_t k = 0;
+        for(uint64_t layer = this->layer_offsets.size() - 1; layer > 0; layer--)
+        {
+            k = k * nr_children + rank(this->nodes[this->layer_offsets[layer] + k], key);
+        }
+        return std::min(k * STREE_NODE_SIZE + rank(this->nodes[k], key), this->n);
+    }
+
+public:
+
+    using iterator = const key_type*;
+
+    // Standard un-parametrized C-tor.
+    STree() : n(0) {}
+
+    // Methods
+    void insert_keys(const array_type& keys)
+    {
+        /*
+         * Rebuilds the tree over its current keys plus 'keys'.
+         */
+        array_type sorted_keys(begin(), end());
+        sorted_keys.insert(sorted_keys.end(), keys.begin(), keys.end());
+        std::sort(sorted_keys.begin(), sorted_keys.end());
+        sorted_keys.erase(std::unique(sorted_keys.begin(), sorted_keys.end()), sorted_keys.end());
+        this->n = sorted_keys.size();
+
+        // Layer sizes, from the leaves up to a single root.
+        std::vector<uint64_t> layer_sizes = {(this->n + STREE_NODE_SIZE - 1) / STREE_NODE_SIZE};
+        while(layer_sizes.back() > 1) layer_sizes.push_back((layer_sizes.back() + nr_children - 1) / nr_children);
+        this->layer_offsets.assign(layer_sizes.size(), 0);
+        for(uint64_t layer = 1; layer < layer_sizes.size(); layer++) this->layer_offsets[layer] = this->layer_offsets[layer - 1] + layer_sizes[layer - 1];
+
+        node_type padding_node;
+        std::fill(std::begin(padding_node.keys), std::end(padding_node.keys), padding_key);
+        this->nodes.assign(this->layer_offsets.back() + layer_sizes.back(), padding_node);
+        std::copy(sorted_keys.begin(), sorted_keys.end(), reinterpret_cast<key_type*>(this->nodes.data()));
+
+        uint64_t leaves_per_node = 1; // Leaves below one node of the current layer.
+        for(uint64_t layer = 1; layer < layer_sizes.size(); layer++)
+        {
+            leaves_per_node *= nr_children;
+            const uint64_t leaves_per_child = leaves_per_node / nr_children;
+            for(uint64_t k = 0; k < layer_sizes[layer]; k++)
+            {
+                node_type& node = this->nodes[this->layer_offsets[layer] + k];
+                for(uint64_t j = 0; j < STREE_NODE_SIZE; j++)
+                {
+                    // Smallest key below child j + 1, i.e. the first key of its leftmost leaf.
+                    const uint64_t first_key = (k * nr_children + j + 1) * leaves_per_child * STREE_NODE_SIZE;
+                    if(first_key < this->n) node.keys[j] = sorted_keys[first_key];
+                }
+            }
+        }
+    }
+
+    bool holds(const key_type& key) const
+    {
+        const uint64_t i = lower_bound_index(key);
+        return i < this->n && begin()[i] == key;
+    }
+
+    iterator lower_bound(const key_type& key) const
+    {
+        return begin() + lower_bound_index(key);
+    }
+
+    iterator begin() const
+    {
+        return reinterpret_cast<const key_type*>(this->nodes.data());
+    }
+
+    iterator end() const
+    {
+        return begin() + this->n;
+    }
+
+    uint64_t size() const
+    {
+        return this->n;
+    }
+
+    uint64_t size_in_bytes() const
+    {
+        return sizeof(*this) + this->nodes.capacity() * sizeof(node_type) + this->layer_offsets.capacity() * sizeof(uint64_t);
+    }
+
+};
+
+#endif //PROJECT_1_STREE_HPP
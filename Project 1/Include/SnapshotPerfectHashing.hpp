@@ -0,0 +1,163 @@
+#ifndef PROJECT_1_SNAPSHOTPERFECTHASHING_HPP
+#define PROJECT_1_SNAPSHOTPERFECTHASHING_HPP
+
+#include "Utilities.hpp"
+
+#define SNAPSHOT_READER_STRIPES 16
+
+
+/*
+ * Serves queries from an immutable static table (PerfectHashing or FlatPerfectHashing) while a
+ * background thread builds its replacement. Readers reach the current table through one atomic
+ * pointer and never wait for the writer. A replaced table is freed after a grace period, i.e. once
+ * every reader that could still be using it has left, detected with two sets of reader counters
+ * whose roles flip twice per grace period (the classic two-phase scheme of userspace RCU).
+ *
+ * 'holds' may be called from any number of threads, the writer methods from one thread at a time.
+ */
+template <typename key_type, typename array_type, typename table_type>
+class SnapshotPerfectHashing
+{
+private:
+    // Readers only touch the counter of their own stripe, so they do not all bounce one cache line.
+    struct alignas(64) reader_counter_type
+    {
+        std::atomic<uint64_t> count = 0;
+    };
+
+    // Attributes
+    unsigned int seed, seed_shift;
+
+    std::atomic<table_type*> current;
+
+    std::atomic<unsigned int> phase;
+    reader_counter_type reader_counters[2][SNAPSHOT_READER_STRIPES];
+
+    array_type keys; // Key set of the most recently requested table, only touched by the writer.
+    std::thread rebuild_thread;
+    std::atomic<bool> rebuilding;
+
+
+    // Methods
+    static unsigned int reader_stripe()
+    {
+        thread_local const unsigned int stripe = std::hash<std::thread::id>{}(std::this_thread::get_id()) % SNAPSHOT_READER_STRIPES;
+        return stripe;
+    }
+
+    table_type* build(const array_type& keys, const unsigned int& seed)
+    {
+        if(keys.empty()) return nullptr;
+        auto* table = new table_type(keys.size(), seed);
+        table->insert_keys(keys, seed);
+        return table;
+    }
+
+    void wait_for_readers(const unsigned int& phase)
+    {
+        for(reader_counter_type& counter : this->reader_counters[phase])
+        {
+            while(counter.count.load() != 0) std::this_thread::yield();
+        }
+    }
+
+    void publish(table_type* table)
+    {
+        /*
+         * Swaps in 'table' and frees the previous one after the grace period. A reader may have
+         * read the phase just before a flip and only registered after the following wait, which is
+         * why the phase is flipped twice, waiting for the readers of the old phase each time.
+         * */
+        table_type* old_table = this->current.exchange(table);
+        for(unsigned int flip = 0; flip < 2; flip++)
+        {
+            unsigned int old_phase = this->phase.fetch_xor(1);
+            wait_for_readers(old_phase);
+        }
+        delete old_table;
+    }
+
+public:
+
+    // Parameterized C-tor
+    [[maybe_unused]] explicit SnapshotPerfectHashing(const array_type& keys, const unsigned int& seed)
+    {
+        this->seed = seed;
+        this->seed_shift = 0;
+        this->phase = 0;
+        this->rebuilding = false;
+        this->keys = keys;
+        std::sort(this->keys.begin(), this->keys.end());
+        this->keys.erase(std::unique(this->keys.begin(), this->keys.end()), this->keys.end());
+        this->current = build(this->keys, this->seed);
+    }
+
+    SnapshotPerfectHashing(const SnapshotPerfectHashing&) = delete;
+    SnapshotPerfectHashing& operator=(const SnapshotPerfectHashing&) = delete;
+
+    ~SnapshotPerfectHashing()
+    {
+        wait_for_rebuild();
+        delete this->current.load();
+    }
+
+    // Methods
+    bool holds(const key_type& key)
+    {
+        /*
+         * Checks whether the provided key is in the current snapshot. Never blocks, and costs one
+         * atomic increment and decrement on top of the lookup in the underlying table.
+         */
+        reader_counter_type& counter = this->reader_counters[this->phase.load()][reader_stripe()];
+        counter.count.fetch_add(1);
+        table_type* table = this->current.load();
+        bool result = table != nullptr && table->holds(key);
+        counter.count.fetch_sub(1);
+        return result;
+    }
+
+    void insert_keys(const array_type& new_keys)
+    {
+        /*
+         * Starts building a table over the current keys plus 'new_keys' in the background and
+         * returns right away. Queries keep being answered by the current table until the new one
+         * is swapped in. If a rebuild is already running it is allowed to finish first.
+         */
+        wait_for_rebuild();
+
+        array_type sorted_new_keys = new_keys;
+        std::sort(sorted_new_keys.begin(), sorted_new_keys.end());
+        sorted_new_keys.erase(std::unique(sorted_new_keys.begin(), sorted_new_keys.end()), sorted_new_keys.end());
+        array_type merged_keys;
+        merged_keys.reserve(this->keys.size() + sorted_new_keys.size());
+        std::set_union(this->keys.begin(), this->keys.end(), sorted_new_keys.begin(), sorted_new_keys.end(), std::back_inserter(merged_keys));
+        this->keys = std::move(merged_keys);
+
+        this->seed_shift++;
+        const unsigned int rebuild_seed = this->seed + this->seed_shift * 11;
+        this->rebuilding = true;
+        this->rebuild_thread = std::thread([this, rebuild_seed]()
+        {
+            publish(build(this->keys, rebuild_seed));
+            this->rebuilding = false;
+        });
+    }
+
+    void wait_for_rebuild()
+    {
+        if(this->rebuild_thread.joinable()) this->rebuild_thread.join();
+    }
+
+    bool is_rebuilding()
+    {
+        return this->rebuilding.load();
+    }
+
+    unsigned int size()
+    {
+        return this->keys.size();
+    }
+
+};
+
+#endif //PROJECT_1_SNAPSHOTPERFECTHASHING_HPP
@@ -0,0 +1,237 @@
+#ifndef PROJECT_1_SWISSTABLESET_HPP
+#define PROJECT_1_SWISSTABLESET_HPP
+
+#include "Utilities.hpp"
+
+#include <bit>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#define SWISS_GROUP_SIZE 16
+#define SWISS_TAG_BIT_SIZE 7
+
+
+template <typename key_type, typename array_type>
+class SwissTableSet
+{
+private:
+    using control_type = int8_t;
+    using control_array_type = std::vector<control_type>;
+    using slot_array_type = std::vector<key_type>;
+    using mask_type = uint32_t;
+
+    // Control bytes: a full slot holds the 7 tag bits of its key (top bit 0),
+    // empty and deleted slots have the top bit set.
+    static constexpr control_type empty_control = -128;  // 0b10000000
+    static constexpr control_type deleted_control = -2;  // 0b11111110
+
+    // Attributes
+    unsigned int nr_groups, nr_keys, nr_deleted;
+
+    key_type a, l;
+
+
+    // Methods
+    void initialize_table()
+    {
+        this->control.assign(this->nr_groups * SWISS_GROUP_SIZE, empty_control);
+        this->slots.assign(this->nr_groups * SWISS_GROUP_SIZE, 0);
+    }
+
+    void initialize_consts(const unsigned int& seed)
+    {
+        /*
+         * Same constant as drawn by 'HashingWithChaining::initialize_consts' for the same seed.
+         * One multiply-shift evaluation gives both the group index (top bits) and the 7-bit tag
+         * (the bits right below), hence l = log2(nr_groups) + 7.
+         * */
+
+        this->a = get_random_odd_uint32(seed);
+        this->l = std::log2(this->nr_groups) + SWISS_TAG_BIT_SIZE;
+    }
+
+    unsigned int smallest_nr_groups(const unsigned int& n)
+    {
+        /*
+         * Smallest power of two number of groups keeping the load at most 7/8 for 'n' keys.
+         * */
+        unsigned int groups = 1;
+        while(8 * (uint64_t)n > 7 * (uint64_t)groups * SWISS_GROUP_SIZE) groups *= 2;
+        return groups;
+    }
+
+    mask_type match(const unsigned int& group, const control_type& value)
+    {
+        /*
+         * Bit i of the returned mask is set if control byte i of the group equals 'value'.
+         * */
+#if defined(__SSE2__)
+        __m128i controls = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&this->control[group * SWISS_GROUP_SIZE]));
+        return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(value), controls));
+#else
+        mask_type mask = 0;
+        for(unsigned int i = 0; i < SWISS_GROUP_SIZE; i++)
+        {
+            if(this->control[group * SWISS_GROUP_SIZE + i] == value) mask |= (1u << i);
+        }
+        return mask;
+#endif
+    }
+
+    mask_type match_empty_or_deleted(const unsigned int& group)
+    {
+        /*
+         * Bit i of the returned mask is set if slot i of the group is not full, i.e. has its top bit set.
+         * */
+#if defined(__SSE2__)
+        __m128i controls = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&this->control[group * SWISS_GROUP_SIZE]));
+        return _mm_movemask_epi8(controls);
+#else
+        mask_type mask = 0;
+        for(unsigned int i = 0; i < SWISS_GROUP_SIZE; i++)
+        {
+            if(this->control[group * SWISS_GROUP_SIZE + i] < 0) mask |= (1u << i);
+        }
+        return mask;
+#endif
+    }
+
+    void place(const key_type& key)
+    {
+        /*
+         * Puts 'key' in the first empty or deleted slot of its probe sequence.
+         * Assumes that the key is not already stored and that there is room.
+         * */
+        key_type hash_value = hash(key, this->a, this->l);
+        unsigned int group = hash_value >> SWISS_TAG_BIT_SIZE;
+        for(unsigned int step = 1; ; step++)
+        {
+            mask_type free_slots = match_empty_or_deleted(group);
+            if(free_slots != 0)
+            {
+                unsigned int slot = group * SWISS_GROUP_SIZE + std::countr_zero(free_slots);
+                if(this->control[slot] == deleted_control) this->nr_deleted--;
+                this->control[slot] = (control_type)(hash_value & ((1u << SWISS_TAG_BIT_SIZE) - 1));
+                this->slots[slot] = key;
+                return;
+            }
+            group = (group + step) & (this->nr_groups - 1); // Triangular probing visits every group once.
+        }
+    }
+
+    void rehash(const unsigned int& new_nr_groups)
+    {
+        /*
+         * Rebuilds the table with 'new_nr_groups' groups, which also drops all deleted markers.
+         * */
+        control_array_type old_control = std::move(this->control);
+        slot_array_type old_slots = std::move(this->slots);
+        this->nr_groups = new_nr_groups;
+        this->l = std::log2(this->nr_groups) + SWISS_TAG_BIT_SIZE;
+        this->nr_deleted = 0;
+        initialize_table();
+        for(unsigned int slot = 0; slot < old_slots.size(); slot++)
+        {
+            if(old_control[slot] >= 0) place(old_slots[slot]);
+        }
+    }
+
+    int find(const key_type& key)
+    {
+        /*
+         * Returns the slot holding 'key' or -1. Only slots whose tag equals the
+         * key's tag are compared, and the search stops at the first group that
+         * has an empty slot.
+         * */
+        key_type hash_value = hash(key, this->a, this->l);
+        unsigned int group = hash_value >> SWISS_TAG_BIT_SIZE;
+        control_type tag = (control_type)(hash_value & ((1u << SWISS_TAG_BIT_SIZE) - 1));
+        for(unsigned int step = 1; step <= this->nr_groups; step++)
+        {
+            mask_type candidates = match(group, tag);
+            while(candidates != 0)
+            {
+                unsigned int slot = group * SWISS_GROUP_SIZE + std::countr_zero(candidates);
+                if(this->slots[slot] == key) return (int)slot;
+                candidates &= candidates - 1;
+            }
+            if(match(group, empty_control) != 0) return -1;
+            group = (group + step) & (this->nr_groups - 1);
+        }
+        return -1;
+    }
+
+public:
+
+    // Attributes
+    control_array_type control;
+    slot_array_type slots;
+
+    // Parameterized C-tor
+    [[maybe_unused]] explicit SwissTableSet(const unsigned int& n, const unsigned int& seed)
+    {
+        this->nr_keys = 0;
+        this->nr_deleted = 0;
+        this->nr_groups = smallest_nr_groups(n);
+        initialize_table();
+        initialize_consts(seed);
+    }
+
+    // Methods
+    void insert(const key_type& key)
+    {
+        if(holds(key)) return; // Set semantics, i.e. no duplicates.
+
+        // Deleted markers count towards the load as they lengthen probe sequences.
+        if(8 * (uint64_t)(this->nr_keys + this->nr_deleted + 1) > 7 * (uint64_t)this->nr_groups * SWISS_GROUP_SIZE)
+        {
+            // Only grow if the live keys need it, otherwise just clean out the deleted markers.
+            if(8 * (uint64_t)(this->nr_keys + 1) > 7 * (uint64_t)this->nr_groups * SWISS_GROUP_SIZE / 2) rehash(2 * this->nr_groups);
+            else rehash(this->nr_groups);
+        }
+        place(key);
+        this->nr_keys++;
+    }
+
+    void insert_keys(const array_type& keys)
+    {
+        for(key_type key : keys) insert(key);
+    }
+
+    bool holds(const key_type& key)
+    {
+        /*
+         * Checks whether the provided key is stored in the hash table.
+         */
+        return find(key) != -1;
+    }
+
+    bool remove(const key_type& key)
+    {
+        /*
+         * Removes the provided key (if present). If its group still has an empty slot no probe
+         * sequence can have passed through the group, so the slot can be marked empty right away.
+         */
+        int slot = find(key);
+        if(slot == -1) return false;
+
+        if(match((unsigned int)slot / SWISS_GROUP_SIZE, empty_control) != 0) this->control[slot] = empty_control;
+        else
+        {
+            this->control[slot] = deleted_control;
+            this->nr_deleted++;
+        }
+        this->nr_keys--;
+        return true;
+    }
+
+    double load_factor()
+    {
+        return (double)this->nr_keys / (this->nr_groups * SWISS_GROUP_SIZE);
+    }
+
+};
+
+#endif //PROJECT_1_SWISSTABLESET_HPP
@@ -0,0 +1,156 @@
+#ifndef PROJECT_1_TWOCHOICEHASHINGWITHCHAINING_HPP
+#define PROJECT_1_TWOCHOICEHASHINGWITHCHAINING_HPP
+
+#include "Utilities.hpp"
+#include "ArenaAllocator.hpp"
+
+#include <bit>
+
+
+/*
+ * Hashing with chaining where every key has two candidate buckets, given by two multiply-shift
+ * hash functions with independent constants, and is inserted into the one holding fewer keys (the
+ * power of two choices). With n keys in m = n buckets the longest chain is then ln ln n / ln 2 + O(1)
+ * rather than the Theta(log n / log log n) of 'HashingWithChaining', which bounds the worst lookup.
+ *
+ * A key may sit in either of its buckets, so 'holds' looks in both. Both bucket heads are prefetched
+ * before either is read, and so is the first node of the second chain while the first is searched,
+ * so the two misses overlap rather than add up.
+ *
+ * Unlike 'HashingWithChaining', growing reinserts all keys at once, as where a key goes depends on
+ * the loads at the time of its insertion.
+ */
+template <typename key_type, typename array_type, typename list_type>
+class TwoChoiceHashingWithChaining
+{
+private:
+    using hash_table_type = std::vector<list_type>;
+
+    // Attributes
+    unsigned int m, nr_keys;
+
+    key_type a_1, a_2, l;
+
+    double max_load_factor;
+
+    // With an arena allocator the table owns the arena, and every list gets a copy of an allocator that
+    // only points to it. Declared before the lists, so the arena outlives them.
+    std::shared_ptr<node_arena> arena;
+    typename list_type::allocator_type allocator = allocator_for<typename list_type::allocator_type>(this->arena);
+
+
+    // Methods
+    static bool bucket_holds(const list_type& bucket, const key_type& key)
+    {
+        /*
+         * Buckets that can search themselves (e.g. 'InlineBucket') do so, lists are scanned.
+         * */
+        if constexpr (requires { bucket.contains(key); }) return bucket.contains(key);
+        else return std::find(bucket.begin(), bucket.end(), key) != bucket.end();
+    }
+
+    void initialize_hash_table()
+    {
+        hash_table.reserve(this->m);    // allocate memory for the array/vector
+        hash_table.assign(this->m, list_type(this->allocator)); // Setting lists in array/vector.
+    }
+
+    void initialize_consts(const unsigned int& seed)
+    {
+        /*
+         * Initializing constants for hash functions here
+         * to avoid continuous recalculation when
+         * calling hash functions.
+         * */
+        this->a_1 = get_random_odd_uint32(seed);
+        unsigned int seed_shift = 1;
+        do this->a_2 = get_random_odd_uint32(seed + seed_shift++ * 11);
+        while(this->a_2 == this->a_1);
+        this->l = std::log2(this->m); // if m = 2^l then l = log2(m)
+    }
+
+    void place(const key_type& key)
+    {
+        // Into the bucket with fewer keys, the first on ties.
+        list_type& bucket_1 = this->hash_table[hash(key, this->a_1, this->l)];
+        list_type& bucket_2 = this->hash_table[hash(key, this->a_2, this->l)];
+        (bucket_2.size() < bucket_1.size() ? bucket_2 : bucket_1).push_back(key);
+    }
+
+    void grow()
+    {
+        /*
+         * Doubles the number of buckets and reinserts the keys in the order they are stored.
+         * */
+        hash_table_type old_table = std::move(this->hash_table);
+        this->l++;
+        this->m = 1u << this->l;
+        this->hash_table = hash_table_type(this->m, list_type(this->allocator));
+        for(const list_type& bucket : old_table)
+        {
+            for(key_type key : bucket) place(key);
+        }
+    }
+
+public:
+
+    // Attributes
+    hash_table_type hash_table;
+
+    // Parameterized C-tor
+    [[maybe_unused]] explicit TwoChoiceHashingWithChaining(const unsigned int& n, const unsigned int& seed, const double& max_load_factor = 1.0)
+    {
+     if(max_load_factor <= 0.0) throw std::runtime_error("Max load factor given to TwoChoiceHashingWithChaining C-tor should be positive.");
+     this->m = std::max(std::bit_ceil(n), 2u); // The hash functions index 2^l buckets, and l = 0 would make them shift by 32.
+     this->nr_keys = 0;
+     this->max_load_factor = max_load_factor;
+     initialize_hash_table();
+     initialize_consts(seed);
+    }
+
+    // Methods
+    void insert(const key_type& key)
+    {
+        if((double)(this->nr_keys + 1) > this->max_load_factor * this->m) grow();
+        place(key);
+        this->nr_keys++;
+    }
+
+    void insert_keys(const array_type& keys)
+    {
+        for(key_type key : keys) insert(key);
+    }
+
+    bool holds(const key_type& key)
+    {
+        /*
+         * Checks whether the provided key is stored in either of its buckets.
+         */
+        const list_type& bucket_1 = this->hash_table[hash(key, this->a_1, this->l)];
+        const list_type& bucket_2 = this->hash_table[hash(key, this->a_2, this->l)];
+        __builtin_prefetch(&bucket_1);
+        __builtin_prefetch(&bucket_2);
+        if(!bucket_2.empty()) __builtin_prefetch(&bucket_2.front());
+        if(!bucket_1.empty() && bucket_holds(bucket_1, key)) return true;
+        return &bucket_2 != &bucket_1 && !bucket_2.empty() && bucket_holds(bucket_2, key);
+    }
+
+    unsigned int max_bucket_size()
+    {
+        unsigned int max_size = 0;
+        for(const list_type& bucket : this->hash_table)
+        {
+            if(bucket.size() > max_size) max_size = bucket.size();
+        }
+        return max_size;
+    }
+
+    double load_factor()
+    {
+        return (double)this->nr_keys / this->m;
+    }
+
+
+};
+
+#endif //PROJECT_1_TWOCHOICEHASHINGWITHCHAINING_HPP
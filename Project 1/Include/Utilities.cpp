@@ -55,7 +55,10 @@ array_type generate_random_keys(const unsigned int& n, const unsigned int& seed)
     std::vector<key_type> keys;
     keys.reserve(n);    // allocate memory for the array/vector
     keys.resize(n); // initialize the array/vector with the given size
-    for(key_type i = 0; i < n; i++) keys[i] = get_random_uint32(seed); // Setting keys in array/vector.
+    // One generator for all keys, reseeding it for every key (as 'get_random_uint32' does) would give n copies of the same key.
+    XoshiroCpp::Xoshiro128PlusPlus generator(seed);
+    std::uniform_int_distribution<key_type> distribution(0, std::pow(2,KEY_BIT_SIZE) - 1);
+    for(key_type i = 0; i < n; i++) keys[i] = distribution(generator); // Setting keys in array/vector.
     return keys;
 }
 
@@ -81,6 +84,24 @@ void remove_file(std::string filename,  std::string path)
     }
 }
 
+void create_folder(std::string path)
+{
+    // Output folders for newly added structures are not necessarily present on the drive yet.
+    if(!std::filesystem::exists(path)) std::filesystem::create_directories(path);
+}
+
+output_data_type percentile(std::vector<output_data_type> values, const double& p)
+{
+    /*
+     * Returns the value below which a fraction 'p' of 'values' lies (nearest rank).
+     * The vector is taken by value as it gets partially sorted.
+     * */
+    if(values.empty()) throw std::runtime_error("Percentile of no values is undefined.");
+    std::size_t rank = std::min(values.size() - 1, (std::size_t)std::ceil(p * values.size()) - (p > 0.0));
+    std::nth_element(values.begin(), values.begin() + rank, values.end());
+    return values[rank];
+}
+
 void print_flag()
 {
     std::cout << "PRINTING HERE!!!" << std::endl;
@@ -16,6 +16,10 @@
 #include <filesystem>
 #include <set>
 #include <algorithm>    // std::random_shuffle
+#include <thread>
+#include <atomic>
+#include <span>
+#include <numeric>
 
 #include <Eigen/Dense>
 
@@ -23,6 +27,9 @@
 
 #define KEY_BIT_SIZE 32
 
+// Number of keys whose memory accesses are overlapped by the batched lookups.
+#define HOLDS_BATCH_SIZE 16
+
 // Defining types.
 using key_type = uint32_t;
 using array_type = std::vector<key_type>;
@@ -49,6 +56,95 @@ void append_to_file(std::string filename, std::string path, std::vector<output_d
 
 void remove_file(std::string filename, std::string path);
 
+void create_folder(std::string path);
+
+output_data_type percentile(std::vector<output_data_type> values, const double& p);
+
 void print_flag();
 
+template <typename task_type>
+void parallel_for(const unsigned int& nr_threads, const unsigned int& nr_tasks, task_type task)
+{
+    /*
+     * Runs task(0), ..., task(nr_tasks - 1) on 'nr_threads' threads (the calling thread included).
+     * Tasks are handed out one at a time, so the tasks themselves must not depend on the order.
+     * */
+    std::atomic<unsigned int> next_task = 0;
+    auto worker = [&]()
+    {
+        for(unsigned int t = next_task++; t < nr_tasks; t = next_task++) task(t);
+    };
+
+    std::vector<std::thread> threads;
+    for(unsigned int i = 1; i < std::min(nr_threads, nr_tasks); i++) threads.emplace_back(worker);
+    worker();
+    for(std::thread& thread : threads) thread.join();
+}
+
+template <typename task_type>
+output_data_type time_in_nanoseconds(task_type task)
+{
+    auto start = std::chrono::high_resolution_clock::now();
+    task();
+    auto stop = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count();
+}
+
+template <typename set_type>
+uint64_t time_ordered_set(set_type& my_set, const array_type& keys, const array_type& queries, const unsigned int& range_length,
+                          std::vector<output_data_type>& results)
+{
+    /*
+     * Benchmark of an ordered set, shared by the ordered set blocks of main. Appends to 'results' the time
+     * of building the set from 'keys', of 'holds' and of 'lower_bound' for all queries, of iterating
+     * 'range_length' keys from the lower bound of every query and of iterating all keys in order, and
+     * the bytes per key. Returns the sum of all keys found, which should be the same for every set (and
+     * keeps the lookups from being optimized away).
+     * */
+    uint64_t checksum = 0;
+    results.push_back(time_in_nanoseconds([&]() { my_set.insert_keys(keys); }));
+    results.push_back(time_in_nanoseconds([&]() { for(key_type key: queries) checksum += my_set.holds(key); }));
+    results.push_back(time_in_nanoseconds([&]()
+    {
+        for(key_type key: queries)
+        {
+            auto iterator = my_set.lower_bound(key);
+            if(iterator != my_set.end()) checksum += *iterator;
+        }
+    }));
+    results.push_back(time_in_nanoseconds([&]()
+    {
+        for(key_type key: queries)
+        {
+            auto iterator = my_set.lower_bound(key);
+            for(unsigned int i = 0; i < range_length && iterator != my_set.end(); i++, ++iterator) checksum += *iterator;
+        }
+    }));
+    results.push_back(time_in_nanoseconds([&]() { for(key_type key: my_set) checksum += key; }));
+    results.push_back((output_data_type)my_set.size_in_bytes() / keys.size());
+    return checksum;
+}
+
+template <typename table_type>
+uint64_t time_chaining_table(table_type& my_table, const array_type& keys, const array_type& queries, std::vector<output_data_type>& results)
+{
+    /*
+     * Benchmark of a hashing with chaining table. Appends to 'results' the time of building the table
+     * from 'keys', its longest chain, the time of all queries in one go and the p99 latency of a single
+     * query. Returns the number of hits, which also keeps the lookups from being optimized away.
+     * */
+    uint64_t nr_hits = 0;
+    results.push_back(time_in_nanoseconds([&]() { my_table.insert_keys(keys); }));
+    results.push_back((output_data_type)my_table.max_bucket_size());
+
+    std::vector<output_data_type> query_latencies(queries.size());
+    for(std::size_t i = 0; i < queries.size(); i++)
+    {
+        query_latencies[i] = time_in_nanoseconds([&]() { nr_hits += my_table.holds(queries[i]); });
+    }
+    results.push_back(time_in_nanoseconds([&]() { for(key_type key: queries) nr_hits += my_table.holds(key); }));
+    results.push_back(percentile(query_latencies, 0.99));
+    return nr_hits;
+}
+
 #endif //PROJECT_1_UTILITIES_HPP
@@ -0,0 +1,169 @@
+#ifndef PROJECT_1_XORFILTER_HPP
+#define PROJECT_1_XORFILTER_HPP
+
+#include "Utilities.hpp"
+
+#include <bit>
+
+// The fingerprint array has XOR_FILTER_SIZE_FACTOR * n + XOR_FILTER_EXTRA_SLOTS slots, enough for peeling to succeed w.h.p.
+#define XOR_FILTER_SIZE_FACTOR 1.23
+#define XOR_FILTER_EXTRA_SLOTS 32
+
+
+/*
+ * Static XOR filter of Graf and Lemire. The fingerprint array is split into 3 segments, and every key
+ * has one slot in each, picked by 32 bits of a 64-bit hash of the key scaled to the segment length
+ * (fastrange). Fingerprints are assigned such that the 3 slots of a key xor to the key's own
+ * fingerprint, so a query is exactly 3 memory accesses, and absent keys match with probability
+ * 2^-(fingerprint bits). The assignment is found by peeling the 3-hypergraph of the keys, drawing a
+ * new hash seed if the hypergraph has a 2-core. Uses about 1.23 fingerprints per key, i.e. ~9.8 bits per key with
+ * 8-bit fingerprints and ~19.7 with 16-bit ones.
+ *
+ * N.B. the slots are not taken from the multiply-shift 'hash'. For a run of consecutive keys, the
+ * three multiply-shift values lie on a lattice, and the resulting hypergraph has a 2-core most of
+ * the time. A seeded SplitMix64 step mixes the key well enough for peeling.
+ */
+template <typename key_type, typename array_type, typename fingerprint_type = uint8_t>
+class XorFilter
+{
+private:
+    // Attributes
+    unsigned int seed, seed_shift;
+    uint64_t segment_length;
+
+    uint64_t hash_seed;
+
+
+    // Methods
+    uint64_t next_hash_seed()
+    {
+        uint64_t hash_seed = ((uint64_t)get_random_uint32(this->seed + this->seed_shift * 11) << 32) | get_random_uint32(this->seed + this->seed_shift * 11 + 1);
+        this->seed_shift++;
+        return hash_seed;
+    }
+
+    uint64_t hash_64(const key_type& key) const
+    {
+        return XoshiroCpp::SplitMix64(this->hash_seed + key)();
+    }
+
+    uint64_t slot(const uint64_t& key_hash, const unsigned int& segment) const
+    {
+        // Each segment uses other 32 bits of the hash, scaled to the segment length (fastrange).
+        const uint32_t bits = std::rotl(key_hash, 21 * segment);
+        return segment * this->segment_length + (((uint64_t)bits * this->segment_length) >> 32);
+    }
+
+    static fingerprint_type fingerprint(const uint64_t& key_hash)
+    {
+        return key_hash ^ (key_hash >> 32);
+    }
+
+public:
+
+    // Attributes
+    std::vector<fingerprint_type> fingerprints;
+
+    // Parameterized C-tor
+    [[maybe_unused]] explicit XorFilter(const unsigned int& n, const unsigned int& seed)
+    {
+        this->seed = seed;
+        this->seed_shift = 0;
+        this->segment_length = ((uint64_t)(XOR_FILTER_SIZE_FACTOR * n) + XOR_FILTER_EXTRA_SLOTS) / 3;
+        this->fingerprints.assign(3 * this->segment_length, 0);
+    }
+
+    // Methods
+    void insert_keys(const array_type& keys)
+    {
+        /*
+         * Builds the filter over 'keys' (the same key array 'PerfectHashing::insert_keys' takes),
+         * replacing its previous contents. Duplicate keys are ignored.
+         */
+        array_type unique_keys = keys;
+        std::sort(unique_keys.begin(), unique_keys.end());
+        unique_keys.erase(std::unique(unique_keys.begin(), unique_keys.end()), unique_keys.end());
+        this->segment_length = std::max<uint64_t>(this->segment_length, ((uint64_t)(XOR_FILTER_SIZE_FACTOR * unique_keys.size()) + XOR_FILTER_EXTRA_SLOTS) / 3);
+        const uint64_t nr_slots = 3 * this->segment_length;
+
+        // Per slot the number of keys hashing to it, and the xor of those keys.
+        std::vector<uint32_t> slot_counts(nr_slots);
+        std::vector<key_type> slot_keys(nr_slots);
+        std::vector<uint64_t> queue;
+        // Keys in peeling order, with the slot that was free for them.
+        std::vector<std::pair<key_type, uint64_t>> peeled;
+        queue.reserve(nr_slots);
+        peeled.reserve(unique_keys.size());
+        do
+        {
+            this->hash_seed = next_hash_seed();
+            std::fill(slot_counts.begin(), slot_counts.end(), 0);
+            std::fill(slot_keys.begin(), slot_keys.end(), 0);
+            queue.clear();
+            peeled.clear();
+
+            for(key_type key : unique_keys)
+            {
+                const uint64_t key_hash = hash_64(key);
+                for(unsigned int segment = 0; segment < 3; segment++)
+                {
+                    uint64_t i = slot(key_hash, segment);
+                    slot_counts[i]++;
+                    slot_keys[i] ^= key;
+                }
+            }
+
+            /*
+             * Peeling. A slot hit by a single key can be given to that key, after which the key is
+             * removed from its other two slots, possibly leaving more slots with a single key.
+             * */
+            for(uint64_t i = 0; i < nr_slots; i++)
+            {
+                if(slot_counts[i] == 1) queue.push_back(i);
+            }
+            while(!queue.empty())
+            {
+                uint64_t i = queue.back();
+                queue.pop_back();
+                if(slot_counts[i] != 1) continue;
+                key_type key = slot_keys[i];
+                peeled.emplace_back(key, i);
+                const uint64_t key_hash = hash_64(key);
+                for(unsigned int segment = 0; segment < 3; segment++)
+                {
+                    uint64_t j = slot(key_hash, segment);
+                    slot_counts[j]--;
+                    slot_keys[j] ^= key;
+                    if(slot_counts[j] == 1) queue.push_back(j);
+                }
+            }
+        } while(peeled.size() != unique_keys.size()); // Otherwise the hypergraph has a 2-core.
+
+        // Assigning in reverse peeling order, every key's free slot is set last among its 3 slots.
+        std::fill(this->fingerprints.begin(), this->fingerprints.end(), 0);
+        this->fingerprints.resize(nr_slots, 0);
+        for(auto it = peeled.rbegin(); it != peeled.rend(); it++)
+        {
+            const auto& [key, i] = *it;
+            const uint64_t key_hash = hash_64(key);
+            this->fingerprints[i] = fingerprint(key_hash) ^ this->fingerprints[slot(key_hash, 0)] ^ this->fingerprints[slot(key_hash, 1)] ^ this->fingerprints[slot(key_hash, 2)];
+        }
+    }
+
+    bool may_contain(const key_type& key) const
+    {
+        /*
+         * False means that the key is not in the set the filter was built from, true that it probably is.
+         */
+        const uint64_t key_hash = hash_64(key);
+        return fingerprint(key_hash) == (this->fingerprints[slot(key_hash, 0)] ^ this->fingerprints[slot(key_hash, 1)] ^ this->fingerprints[slot(key_hash, 2)]);
+    }
+
+    uint64_t size_in_bytes() const
+    {
+        return sizeof(*this) + this->fingerprints.capacity() * sizeof(fingerprint_type);
+    }
+
+};
+
+#endif //PROJECT_1_XORFILTER_HPP
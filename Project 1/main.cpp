@@ -4,6 +4,28 @@
 #include "HashingWithChaining.hpp"
 #include "RedBlackTree.hpp"
 #include "PerfectHashing.hpp"
+#include "LinearProbingSet.hpp"
+#include "RobinHoodSet.hpp"
+#include "SwissTableSet.hpp"
+#include "CuckooHashSet.hpp"
+#include "FlatPerfectHashing.hpp"
+#include "MappedPerfectHashing.hpp"
+#include "ConcurrentHashingWithChaining.hpp"
+#include "SnapshotPerfectHashing.hpp"
+#include "DynamicPerfectHashing.hpp"
+#include "ArenaAllocator.hpp"
+#include "InlineBucket.hpp"
+#include "BlockedBloomFilter.hpp"
+#include "CountingQuotientFilter.hpp"
+#include "XorFilter.hpp"
+#include "EytzingerSet.hpp"
+#include "STree.hpp"
+#include "BitmapUniverseSet.hpp"
+#include "MinimalPerfectHashing.hpp"
+#include "LearnedIndex.hpp"
+#include "EliasFanoSet.hpp"
+#include "CompactHashingWithChaining.hpp"
+#include "TwoChoiceHashingWithChaining.hpp"
 #include "Utilities.hpp"
 
 
@@ -16,6 +38,7 @@ int main()
 {
     const unsigned int iterations = 14;
     const unsigned int seed_multiplier = 7;
+    const unsigned int interleaved_group_size = 16; // Number of lookups in flight for 'holds_interleaved'.
 
     //// ----------------- Testing Hashing With Chaining implementation ----------------- ////
     std::cout << " \n-------- Hashing with Chaining --------\n " << std::endl;
@@ -57,11 +80,26 @@ int main()
             stop = std::chrono::high_resolution_clock::now();
             output_data_type query_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
 
+            // Testing batched query complexity
+            std::vector<uint8_t> batch_results(n);
+            start = std::chrono::high_resolution_clock::now();
+            my_hash_table.holds_batch(random_keys, batch_results);
+            stop = std::chrono::high_resolution_clock::now();
+            output_data_type batch_query_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+
+            // Testing interleaved query complexity
+            start = std::chrono::high_resolution_clock::now();
+            std::vector<uint8_t> interleaved_results = my_hash_table.holds_interleaved(random_keys, interleaved_group_size);
+            stop = std::chrono::high_resolution_clock::now();
+            output_data_type interleaved_query_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+
             // Saving time and sizes
             append_to_file(filename, folder_path, {(output_data_type)n,
                                                    insertion_duration,
                                                    (output_data_type)max_size,
-                                                   query_duration});
+                                                   query_duration,
+                                                   batch_query_duration,
+                                                   interleaved_query_duration});
         }
 
     }
@@ -103,10 +141,17 @@ int main()
             stop = std::chrono::high_resolution_clock::now();
             output_data_type query_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
 
+            // Testing interleaved query complexity, including laying out the keys for it on this first call
+            start = std::chrono::high_resolution_clock::now();
+            std::vector<uint8_t> interleaved_results = my_red_black_tree.holds_interleaved(random_keys, interleaved_group_size);
+            stop = std::chrono::high_resolution_clock::now();
+            output_data_type interleaved_query_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+
             // Saving time and sizes
             append_to_file(filename, folder_path, {(output_data_type)n,
                                                               insertion_duration,
-                                                              query_duration});
+                                                              query_duration,
+                                                              interleaved_query_duration});
         }
 
     }
@@ -149,10 +194,1337 @@ int main()
             stop = std::chrono::high_resolution_clock::now();
             output_data_type query_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
 
+            // Getting memory footprint of the structure
+            output_data_type bytes_per_key = (output_data_type)my_perfect_hash_table.size_in_bytes() / n;
+
+            // Testing batched query complexity
+            std::vector<uint8_t> batch_results(n);
+            start = std::chrono::high_resolution_clock::now();
+            my_perfect_hash_table.holds_batch(random_keys, batch_results);
+            stop = std::chrono::high_resolution_clock::now();
+            output_data_type batch_query_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+
             // Saving time and sizes
             append_to_file(filename, folder_path, {(output_data_type)n,
                                                                insertion_duration,
-                                                               query_duration});
+                                                               query_duration,
+                                                               bytes_per_key,
+                                                               batch_query_duration});
+        }
+
+    }
+
+    //// ----------------- Testing Linear Probing implementation ----------------- ////
+    std::cout << " \n-------- Linear Probing --------\n " << std::endl;
+
+    using linear_probing_set = LinearProbingSet<key_type, array_type>;
+    nr_seeds = 500;
+    folder_path = "../../Data/LinearProbing";
+    create_folder(folder_path);
+    for(unsigned int seed = 0; seed < nr_seeds; seed++)
+    {
+        std::cout << "Seed iteration nr.: " << seed << std::endl;
+
+        // Timing insertion and query for various n
+        std::string filename = "LP_insertion_timing_"+std::to_string(seed_multiplier*seed)+".txt";
+        remove_file(filename,folder_path); // Removing possibly already existing file with name 'filename' from drive.
+        for(key_type w = 5; w <= (key_type)(5+iterations); w++)
+        {
+            // Defining number of keys as power of 2 to enable use of Multiply-Shift hash function
+            key_type n = std::pow(2,w);
+
+            // Generating linear probing set and keys
+            linear_probing_set my_linear_probing_set = linear_probing_set(n, seed_multiplier*seed);
+            array_type my_keys = generate_ordered_keys(n);
+
+            // Inserting keys and timing the execution
+            auto start = std::chrono::high_resolution_clock::now();
+            my_linear_probing_set.insert_keys(my_keys);
+            auto stop = std::chrono::high_resolution_clock::now();
+            output_data_type insertion_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+
+            // Getting length of the longest probe sequence in the table
+            unsigned int max_length = my_linear_probing_set.max_probe_length();
+
+            // Testing query complexity
+            array_type random_keys = generate_random_keys(n,seed_multiplier*seed);
+            start = std::chrono::high_resolution_clock::now();
+            for(key_type key: random_keys) bool _ = my_linear_probing_set.holds(key);
+            stop = std::chrono::high_resolution_clock::now();
+            output_data_type query_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+
+            // Saving time and sizes
+            append_to_file(filename, folder_path, {(output_data_type)n,
+                                                   insertion_duration,
+                                                   (output_data_type)max_length,
+                                                   query_duration});
+        }
+
+    }
+
+    //// ----------------- Testing Robin Hood Hashing implementation ----------------- ////
+    std::cout << " \n-------- Robin Hood Hashing --------\n " << std::endl;
+
+    using robin_hood_set = RobinHoodSet<key_type, array_type>;
+    nr_seeds = 500;
+    folder_path = "../../Data/RobinHood";
+    create_folder(folder_path);
+    for(unsigned int seed = 0; seed < nr_seeds; seed++)
+    {
+        std::cout << "Seed iteration nr.: " << seed << std::endl;
+
+        // Timing insertion and query for various n
+        std::string filename = "RH_insertion_timing_"+std::to_string(seed_multiplier*seed)+".txt";
+        remove_file(filename,folder_path); // Removing possibly already existing file with name 'filename' from drive.
+        for(key_type w = 5; w <= (key_type)(5+iterations); w++)
+        {
+            // Defining number of keys as power of 2 to enable use of Multiply-Shift hash function
+            key_type n = std::pow(2,w);
+
+            // Generating Robin Hood set and keys
+            robin_hood_set my_robin_hood_set = robin_hood_set(n, seed_multiplier*seed);
+            array_type my_keys = generate_ordered_keys(n);
+
+            // Inserting keys and timing the execution
+            auto start = std::chrono::high_resolution_clock::now();
+            my_robin_hood_set.insert_keys(my_keys);
+            auto stop = std::chrono::high_resolution_clock::now();
+            output_data_type insertion_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+
+            // Getting probe sequence length statistics of the table
+            unsigned int max_length = my_robin_hood_set.max_probe_length();
+            output_data_type average_length = my_robin_hood_set.average_probe_length();
+
+            // Testing query complexity
+            array_type random_keys = generate_random_keys(n,seed_multiplier*seed);
+            start = std::chrono::high_resolution_clock::now();
+            for(key_type key: random_keys) bool _ = my_robin_hood_set.holds(key);
+            stop = std::chrono::high_resolution_clock::now();
+            output_data_type query_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+
+            // Saving time and sizes
+            append_to_file(filename, folder_path, {(output_data_type)n,
+                                                   insertion_duration,
+                                                   (output_data_type)max_length,
+                                                   average_length,
+                                                   query_duration});
+        }
+
+    }
+
+    //// ----------------- Testing Swiss Table implementation ----------------- ////
+    std::cout << " \n-------- Swiss Table --------\n " << std::endl;
+
+    using swiss_table_set = SwissTableSet<key_type, array_type>;
+    nr_seeds = 500;
+    folder_path = "../../Data/SwissTable";
+    create_folder(folder_path);
+    for(unsigned int seed = 0; seed < nr_seeds; seed++)
+    {
+        std::cout << "Seed iteration nr.: " << seed << std::endl;
+
+        // Timing insertion and query for various n
+        std::string filename = "ST_insertion_timing_"+std::to_string(seed_multiplier*seed)+".txt";
+        remove_file(filename,folder_path); // Removing possibly already existing file with name 'filename' from drive.
+        for(key_type w = 5; w <= (key_type)(5+iterations); w++)
+        {
+            // Defining number of keys as power of 2 to enable use of Multiply-Shift hash function
+            key_type n = std::pow(2,w);
+
+            // Generating swiss table and keys, plus a chaining table with the same n and seed as reference
+            swiss_table_set my_swiss_table = swiss_table_set(n, seed_multiplier*seed);
+            hash_table my_hash_table = hash_table(n, seed_multiplier*seed);
+            array_type my_keys = generate_ordered_keys(n);
+            my_hash_table.insert_keys(my_keys);
+
+            // Inserting keys and timing the execution
+            auto start = std::chrono::high_resolution_clock::now();
+            my_swiss_table.insert_keys(my_keys);
+            auto stop = std::chrono::high_resolution_clock::now();
+            output_data_type insertion_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+
+            // Testing query complexity
+            array_type random_keys = generate_random_keys(n,seed_multiplier*seed);
+            start = std::chrono::high_resolution_clock::now();
+            for(key_type key: random_keys) bool _ = my_swiss_table.holds(key);
+            stop = std::chrono::high_resolution_clock::now();
+            output_data_type query_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+
+            // Testing query complexity of chaining on the same keys
+            start = std::chrono::high_resolution_clock::now();
+            for(key_type key: random_keys) bool _ = my_hash_table.holds(key);
+            stop = std::chrono::high_resolution_clock::now();
+            output_data_type chaining_query_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+
+            // Saving time and sizes
+            append_to_file(filename, folder_path, {(output_data_type)n,
+                                                   insertion_duration,
+                                                   query_duration,
+                                                   chaining_query_duration});
+        }
+
+    }
+
+    //// ----------------- Testing Bucketized Cuckoo Hashing implementation ----------------- ////
+    std::cout << " \n-------- Bucketized Cuckoo Hashing --------\n " << std::endl;
+
+    using cuckoo_hash_set = CuckooHashSet<key_type, array_type>;
+    nr_seeds = 500;
+    folder_path = "../../Data/CuckooHashing";
+    create_folder(folder_path);
+    for(unsigned int seed = 0; seed < nr_seeds; seed++)
+    {
+        std::cout << "Seed iteration nr.: " << seed << std::endl;
+
+        // Timing insertion and query for various n
+        std::string filename = "CH_insertion_timing_"+std::to_string(seed_multiplier*seed)+".txt";
+        remove_file(filename,folder_path); // Removing possibly already existing file with name 'filename' from drive.
+        for(key_type w = 5; w <= (key_type)(5+iterations); w++)
+        {
+            // Defining number of keys as power of 2 to enable use of Multiply-Shift hash function
+            key_type n = std::pow(2,w);
+
+            // Generating cuckoo hash set and keys
+            cuckoo_hash_set my_cuckoo_hash_set = cuckoo_hash_set(n, seed_multiplier*seed);
+            array_type my_keys = generate_ordered_keys(n);
+
+            // Inserting keys and timing the execution
+            auto start = std::chrono::high_resolution_clock::now();
+            my_cuckoo_hash_set.insert_keys(my_keys);
+            auto stop = std::chrono::high_resolution_clock::now();
+            output_data_type insertion_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+
+            // Testing query complexity
+            array_type random_keys = generate_random_keys(n,seed_multiplier*seed);
+            start = std::chrono::high_resolution_clock::now();
+            for(key_type key: random_keys) bool _ = my_cuckoo_hash_set.holds(key);
+            stop = std::chrono::high_resolution_clock::now();
+            output_data_type query_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+
+            // Saving time and sizes
+            append_to_file(filename, folder_path, {(output_data_type)n,
+                                                   insertion_duration,
+                                                   query_duration,
+                                                   (output_data_type)my_cuckoo_hash_set.stash.size()});
+        }
+
+    }
+
+    //// ----------------- Testing Flat Perfect Hashing implementation ----------------- ////
+    std::cout << " \n-------- Flat Perfect Hashing --------\n " << std::endl;
+
+    using flat_perfect_hashing = FlatPerfectHashing<key_type, array_type>;
+    nr_seeds = 500;
+    folder_path = "../../Data/FlatPerfectHashing";
+    create_folder(folder_path);
+    for(unsigned int seed = 0; seed < nr_seeds; seed++)
+    {
+        std::cout << "Seed iteration nr.: " << seed << std::endl;
+
+        // Timing insertion and query for various n
+        std::string filename = "FPH_insertion_timing_"+std::to_string(seed_multiplier*seed)+".txt";
+        remove_file(filename,folder_path); // Removing possibly already existing file with name 'filename' from drive.
+        for(key_type w = 5; w <= (key_type)(5+iterations); w++)
+        {
+            // Defining number of keys as power of 2 to enable use of Multiply-Shift hash function
+            key_type n = std::pow(2,w);
+
+            // Generating flat perfect hashing structure and keys
+            flat_perfect_hashing my_flat_perfect_hash_table = flat_perfect_hashing(n, seed_multiplier*seed);
+            array_type my_keys = generate_ordered_keys(n);
+
+            // Inserting keys and timing the execution
+            auto start = std::chrono::high_resolution_clock::now();
+            my_flat_perfect_hash_table.insert_keys(my_keys,seed_multiplier*seed);
+            auto stop = std::chrono::high_resolution_clock::now();
+            output_data_type insertion_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+
+            // Testing query complexity
+            array_type random_keys = generate_random_keys(n,seed_multiplier*seed);
+            start = std::chrono::high_resolution_clock::now();
+            for(key_type key: random_keys) bool _ = my_flat_perfect_hash_table.holds(key);
+            stop = std::chrono::high_resolution_clock::now();
+            output_data_type query_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+
+            // Getting memory footprint of the structure
+            output_data_type bytes_per_key = (output_data_type)my_flat_perfect_hash_table.size_in_bytes() / n;
+
+            // Saving time and sizes
+            append_to_file(filename, folder_path, {(output_data_type)n,
+                                                   insertion_duration,
+                                                   query_duration,
+                                                   bytes_per_key});
+        }
+
+    }
+
+    //// ----------------- Testing multi-threaded Flat Perfect Hashing construction ----------------- ////
+    std::cout << " \n-------- Parallel Flat Perfect Hashing --------\n " << std::endl;
+
+    const unsigned int nr_threads = std::max(1u, std::thread::hardware_concurrency());
+    nr_seeds = 500;
+    folder_path = "../../Data/ParallelFlatPerfectHashing";
+    create_folder(folder_path);
+    for(unsigned int seed = 0; seed < nr_seeds; seed++)
+    {
+        std::cout << "Seed iteration nr.: " << seed << std::endl;
+
+        // Timing single- and multi-threaded construction for various n
+        std::string filename = "PFPH_insertion_timing_"+std::to_string(seed_multiplier*seed)+".txt";
+        remove_file(filename,folder_path); // Removing possibly already existing file with name 'filename' from drive.
+        for(key_type w = 5; w <= (key_type)(5+iterations); w++)
+        {
+            // Defining number of keys as power of 2 to enable use of Multiply-Shift hash function
+            key_type n = std::pow(2,w);
+            array_type my_keys = generate_ordered_keys(n);
+
+            // Single-threaded construction
+            flat_perfect_hashing my_serial_table = flat_perfect_hashing(n, seed_multiplier*seed);
+            auto start = std::chrono::high_resolution_clock::now();
+            my_serial_table.insert_keys(my_keys,seed_multiplier*seed,1);
+            auto stop = std::chrono::high_resolution_clock::now();
+            output_data_type serial_insertion_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+
+            // Multi-threaded construction (gives the same table as the single-threaded one)
+            flat_perfect_hashing my_parallel_table = flat_perfect_hashing(n, seed_multiplier*seed);
+            start = std::chrono::high_resolution_clock::now();
+            my_parallel_table.insert_keys(my_keys,seed_multiplier*seed,nr_threads);
+            stop = std::chrono::high_resolution_clock::now();
+            output_data_type parallel_insertion_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+
+            // Saving time and sizes
+            append_to_file(filename, folder_path, {(output_data_type)n,
+                                                   serial_insertion_duration,
+                                                   parallel_insertion_duration,
+                                                   (output_data_type)nr_threads});
+        }
+
+    }
+
+    //// ----------------- Testing memory-mapped Perfect Hashing tables ----------------- ////
+    std::cout << " \n-------- Mapped Perfect Hashing --------\n " << std::endl;
+
+    using mapped_perfect_hashing = MappedPerfectHashing<key_type>;
+    nr_seeds = 500;
+    folder_path = "../../Data/MappedPerfectHashing";
+    create_folder(folder_path);
+    for(unsigned int seed = 0; seed < nr_seeds; seed++)
+    {
+        std::cout << "Seed iteration nr.: " << seed << std::endl;
+
+        // Timing saving, loading and query for various n
+        std::string filename = "MPH_loading_timing_"+std::to_string(seed_multiplier*seed)+".txt";
+        remove_file(filename,folder_path); // Removing possibly already existing file with name 'filename' from drive.
+        std::string table_filename = folder_path+"/MPH_table.bin";
+        for(key_type w = 5; w <= (key_type)(5+iterations); w++)
+        {
+            // Defining number of keys as power of 2 to enable use of Multiply-Shift hash function
+            key_type n = std::pow(2,w);
+
+            // Generating flat perfect hashing structure and keys
+            flat_perfect_hashing my_flat_perfect_hash_table = flat_perfect_hashing(n, seed_multiplier*seed);
+            array_type my_keys = generate_ordered_keys(n);
+
+            // Building the table and timing the execution
+            auto start = std::chrono::high_resolution_clock::now();
+            my_flat_perfect_hash_table.insert_keys(my_keys,seed_multiplier*seed);
+            auto stop = std::chrono::high_resolution_clock::now();
+            output_data_type insertion_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+
+            // Writing the table to the drive and timing the execution
+            start = std::chrono::high_resolution_clock::now();
+            my_flat_perfect_hash_table.save(table_filename);
+            stop = std::chrono::high_resolution_clock::now();
+            output_data_type saving_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+
+            // Mapping the table back in and timing the execution
+            start = std::chrono::high_resolution_clock::now();
+            mapped_perfect_hashing my_mapped_table = mapped_perfect_hashing(table_filename);
+            stop = std::chrono::high_resolution_clock::now();
+            output_data_type loading_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+
+            // Testing query complexity straight from the mapped pages
+            array_type random_keys = generate_random_keys(n,seed_multiplier*seed);
+            start = std::chrono::high_resolution_clock::now();
+            for(key_type key: random_keys) bool _ = my_mapped_table.holds(key);
+            stop = std::chrono::high_resolution_clock::now();
+            output_data_type query_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+
+            // Saving time and sizes
+            append_to_file(filename, folder_path, {(output_data_type)n,
+                                                   insertion_duration,
+                                                   saving_duration,
+                                                   loading_duration,
+                                                   query_duration});
+        }
+        std::filesystem::remove(table_filename); // Only the timings are kept.
+
+    }
+
+    //// ----------------- Testing incremental growth of Hashing With Chaining ----------------- ////
+    std::cout << " \n-------- Growing Hashing with Chaining --------\n " << std::endl;
+
+    nr_seeds = 500;
+    folder_path = "../../Data/GrowingHashingWithChaining";
+    create_folder(folder_path);
+    for(unsigned int seed = 0; seed < nr_seeds; seed++)
+    {
+        std::cout << "Seed iteration nr.: " << seed << std::endl;
+
+        // Timing single insertions into a table that starts out small and doubles many times
+        std::string filename = "GHWC_insertion_latency_"+std::to_string(seed_multiplier*seed)+".txt";
+        remove_file(filename,folder_path); // Removing possibly already existing file with name 'filename' from drive.
+        for(key_type w = 5; w <= (key_type)(5+iterations); w++)
+        {
+            key_type n = std::pow(2,w);
+
+            // Generating hash_table with a size hint far below n, and keys
+            hash_table my_hash_table = hash_table(2, seed_multiplier*seed);
+            array_type my_keys = generate_ordered_keys(n);
+
+            // Inserting keys one by one, timing every insertion
+            std::vector<output_data_type> insertion_latencies(n);
+            for(key_type i = 0; i < n; i++)
+            {
+                auto start = std::chrono::high_resolution_clock::now();
+                my_hash_table.insert(my_keys[i]);
+                auto stop = std::chrono::high_resolution_clock::now();
+                insertion_latencies[i] = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+            }
+            output_data_type insertion_duration = std::accumulate(insertion_latencies.begin(), insertion_latencies.end(), (output_data_type)0);
+            output_data_type p99_insertion_latency = percentile(insertion_latencies, 0.99);
+            output_data_type max_insertion_latency = *std::max_element(insertion_latencies.begin(), insertion_latencies.end());
+
+            // Testing query complexity after growth
+            array_type random_keys = generate_random_keys(n,seed_multiplier*seed);
+            auto start = std::chrono::high_resolution_clock::now();
+            for(key_type key: random_keys) bool _ = my_hash_table.holds(key);
+            auto stop = std::chrono::high_resolution_clock::now();
+            output_data_type query_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+
+            // Saving time and sizes
+            append_to_file(filename, folder_path, {(output_data_type)n,
+                                                   insertion_duration,
+                                                   p99_insertion_latency,
+                                                   max_insertion_latency,
+                                                   (output_data_type)my_hash_table.max_bucket_size(),
+                                                   query_duration});
+        }
+
+    }
+
+    //// ----------------- Testing Concurrent Hashing With Chaining implementation ----------------- ////
+    std::cout << " \n-------- Concurrent Hashing with Chaining --------\n " << std::endl;
+
+    using concurrent_hash_table = ConcurrentHashingWithChaining<key_type, array_type, linked_list_type>;
+    const unsigned int max_nr_threads = std::max(1u, std::thread::hardware_concurrency());
+    const key_type nr_preloaded_keys = std::pow(2,18);
+    const key_type nr_operations = std::pow(2,22);
+    nr_seeds = 20;
+    folder_path = "../../Data/ConcurrentHashingWithChaining";
+    create_folder(folder_path);
+    for(unsigned int seed = 0; seed < nr_seeds; seed++)
+    {
+        std::cout << "Seed iteration nr.: " << seed << std::endl;
+
+        // Timing a mixed load of 90% queries and 10% insertions for various numbers of threads
+        std::string filename = "CHWC_throughput_"+std::to_string(seed_multiplier*seed)+".txt";
+        remove_file(filename,folder_path); // Removing possibly already existing file with name 'filename' from drive.
+        for(unsigned int nr_threads = 1; nr_threads <= max_nr_threads; nr_threads++)
+        {
+            // Generating operations up front, every thread gets its own share
+            std::vector<array_type> thread_keys(nr_threads);
+            for(unsigned int t = 0; t < nr_threads; t++)
+            {
+                XoshiroCpp::Xoshiro128PlusPlus generator(seed_multiplier*seed + t);
+                for(key_type i = 0; i < nr_operations / nr_threads; i++) thread_keys[t].push_back(generator());
+            }
+            auto run_operations = [&](auto& table, unsigned int t)
+            {
+                for(key_type key : thread_keys[t])
+                {
+                    if(key % 10 == 0) table.insert(key);
+                    else bool _ = table.holds(key);
+                }
+            };
+
+            // Lock striped table
+            concurrent_hash_table my_concurrent_hash_table = concurrent_hash_table(nr_preloaded_keys, seed_multiplier*seed);
+            my_concurrent_hash_table.insert_keys(generate_ordered_keys(nr_preloaded_keys));
+            auto start = std::chrono::high_resolution_clock::now();
+            parallel_for(nr_threads, nr_threads, [&](unsigned int t) { run_operations(my_concurrent_hash_table, t); });
+            auto stop = std::chrono::high_resolution_clock::now();
+            output_data_type concurrent_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+
+            // Plain table behind one global mutex, as the baseline
+            struct locked_hash_table_type
+            {
+                hash_table table;
+                std::mutex mutex;
+                locked_hash_table_type(const unsigned int& n, const unsigned int& seed) : table(n, seed), mutex() {}
+                void insert(const key_type& key) { std::lock_guard<std::mutex> lock(mutex); table.insert(key); }
+                bool holds(const key_type& key) { std::lock_guard<std::mutex> lock(mutex); return table.holds(key); }
+            } my_locked_hash_table(nr_preloaded_keys, seed_multiplier*seed);
+            my_locked_hash_table.table.insert_keys(generate_ordered_keys(nr_preloaded_keys));
+            start = std::chrono::high_resolution_clock::now();
+            parallel_for(nr_threads, nr_threads, [&](unsigned int t) { run_operations(my_locked_hash_table, t); });
+            stop = std::chrono::high_resolution_clock::now();
+            output_data_type locked_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+
+            // Saving throughput in operations per second
+            output_data_type nr_performed_operations = (output_data_type)(nr_operations / nr_threads) * nr_threads;
+            append_to_file(filename, folder_path, {(output_data_type)nr_threads,
+                                                   nr_performed_operations / concurrent_duration * 1e9,
+                                                   nr_performed_operations / locked_duration * 1e9});
+        }
+
+    }
+
+    //// ----------------- Testing Perfect Hashing behind published snapshots ----------------- ////
+    std::cout << " \n-------- Snapshot Perfect Hashing --------\n " << std::endl;
+
+    using snapshot_perfect_hashing = SnapshotPerfectHashing<key_type, array_type, PerfectHashing>;
+    nr_seeds = 100;
+    folder_path = "../../Data/SnapshotPerfectHashing";
+    create_folder(folder_path);
+    for(unsigned int seed = 0; seed < nr_seeds; seed++)
+    {
+        std::cout << "Seed iteration nr.: " << seed << std::endl;
+
+        // Timing single queries with and without a rebuild running in the background
+        std::string filename = "SPH_query_latency_"+std::to_string(seed_multiplier*seed)+".txt";
+        remove_file(filename,folder_path); // Removing possibly already existing file with name 'filename' from drive.
+        for(key_type w = 5; w <= (key_type)(5+iterations); w++)
+        {
+            key_type n = std::pow(2,w);
+
+            // Generating snapshot table over the even half of 2n ordered keys, the odd half is added later
+            array_type my_keys = generate_ordered_keys(2*n);
+            array_type initial_keys, added_keys;
+            for(key_type i = 0; i < 2*n; i++) (i % 2 == 0 ? initial_keys : added_keys).push_back(my_keys[i]);
+            snapshot_perfect_hashing my_snapshot_table = snapshot_perfect_hashing(initial_keys, seed_multiplier*seed);
+
+            XoshiroCpp::Xoshiro128PlusPlus generator(seed_multiplier*seed);
+            auto time_query = [&]()
+            {
+                key_type key = my_keys[generator() % (2*n)];
+                auto start = std::chrono::high_resolution_clock::now();
+                bool _ = my_snapshot_table.holds(key);
+                auto stop = std::chrono::high_resolution_clock::now();
+                return (output_data_type)duration_cast<std::chrono::nanoseconds>(stop - start).count();
+            };
+
+            // Query latencies while idle
+            std::vector<output_data_type> idle_latencies(n);
+            for(key_type i = 0; i < n; i++) idle_latencies[i] = time_query();
+
+            // Query latencies while the table over all 2n keys is built and swapped in
+            std::vector<output_data_type> rebuild_latencies;
+            auto start = std::chrono::high_resolution_clock::now();
+            my_snapshot_table.insert_keys(added_keys);
+            while(my_snapshot_table.is_rebuilding()) rebuild_latencies.push_back(time_query());
+            my_snapshot_table.wait_for_rebuild();
+            auto stop = std::chrono::high_resolution_clock::now();
+            output_data_type rebuild_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+            if(rebuild_latencies.empty()) rebuild_latencies.push_back(time_query());
+
+            // Saving time and latencies
+            append_to_file(filename, folder_path, {(output_data_type)n,
+                                                   rebuild_duration,
+                                                   percentile(idle_latencies, 0.5),
+                                                   percentile(idle_latencies, 0.99),
+                                                   percentile(rebuild_latencies, 0.5),
+                                                   percentile(rebuild_latencies, 0.99),
+                                                   (output_data_type)rebuild_latencies.size()});
+        }
+
+    }
+
+    //// ----------------- Testing Dynamic Perfect Hashing implementation ----------------- ////
+    std::cout << " \n-------- Dynamic Perfect Hashing --------\n " << std::endl;
+
+    using dynamic_perfect_hashing = DynamicPerfectHashing<key_type, array_type>;
+    nr_seeds = 500;
+    folder_path = "../../Data/DynamicPerfectHashing";
+    create_folder(folder_path);
+    for(unsigned int seed = 0; seed < nr_seeds; seed++)
+    {
+        std::cout << "Seed iteration nr.: " << seed << std::endl;
+
+        // Timing insertion, query and removal for various n
+        std::string filename = "DPH_insertion_timing_"+std::to_string(seed_multiplier*seed)+".txt";
+        remove_file(filename,folder_path); // Removing possibly already existing file with name 'filename' from drive.
+        for(key_type w = 5; w <= (key_type)(5+iterations); w++)
+        {
+            key_type n = std::pow(2,w);
+
+            // Generating dynamic perfect hash table and keys. Starting small, so it rebuilds as it grows.
+            dynamic_perfect_hashing my_dynamic_perfect_hash_table = dynamic_perfect_hashing(2, seed_multiplier*seed);
+            array_type my_keys = generate_ordered_keys(n);
+
+            // Inserting keys one at a time and timing the execution
+            auto start = std::chrono::high_resolution_clock::now();
+            my_dynamic_perfect_hash_table.insert_keys(my_keys);
+            auto stop = std::chrono::high_resolution_clock::now();
+            output_data_type insertion_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+
+            // Testing query complexity
+            array_type random_keys = generate_random_keys(n,seed_multiplier*seed);
+            start = std::chrono::high_resolution_clock::now();
+            for(key_type key: random_keys) bool _ = my_dynamic_perfect_hash_table.holds(key);
+            stop = std::chrono::high_resolution_clock::now();
+            output_data_type query_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+
+            // Getting size in memory per key
+            output_data_type bytes_per_key = (output_data_type)my_dynamic_perfect_hash_table.size_in_bytes() / n;
+
+            // Removing every other key and timing the execution
+            start = std::chrono::high_resolution_clock::now();
+            for(key_type i = 0; i < n; i += 2) my_dynamic_perfect_hash_table.remove(my_keys[i]);
+            stop = std::chrono::high_resolution_clock::now();
+            output_data_type removal_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+
+            // Saving time and sizes
+            append_to_file(filename, folder_path, {(output_data_type)n,
+                                                   insertion_duration,
+                                                   query_duration,
+                                                   bytes_per_key,
+                                                   removal_duration});
+        }
+
+    }
+
+    //// ----------------- Testing Hashing With Chaining on arena allocated lists ----------------- ////
+    std::cout << " \n-------- Arena Hashing with Chaining --------\n " << std::endl;
+
+    using arena_hash_table = HashingWithChaining<key_type, array_type, std::list<key_type, ArenaAllocator<key_type>>>;
+    nr_seeds = 500;
+    folder_path = "../../Data/ArenaHashingWithChaining";
+    create_folder(folder_path);
+    for(unsigned int seed = 0; seed < nr_seeds; seed++)
+    {
+        std::cout << "Seed iteration nr.: " << seed << std::endl;
+
+        // Timing insertion, query and destruction for the default and the arena allocator for various n
+        std::string filename = "AHWC_insertion_timing_"+std::to_string(seed_multiplier*seed)+".txt";
+        remove_file(filename,folder_path); // Removing possibly already existing file with name 'filename' from drive.
+        for(key_type w = 5; w <= (key_type)(5+iterations); w++)
+        {
+            key_type n = std::pow(2,w);
+            array_type my_keys = generate_ordered_keys(n);
+            array_type random_keys = generate_random_keys(n,seed_multiplier*seed);
+
+            // Same measurements for both tables: insertion, query (locality of the chains) and freeing the table
+            auto time_table = [&](auto* my_table)
+            {
+                auto start = std::chrono::high_resolution_clock::now();
+                my_table->insert_keys(my_keys);
+                auto stop = std::chrono::high_resolution_clock::now();
+                output_data_type insertion_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+
+                start = std::chrono::high_resolution_clock::now();
+                for(key_type key: my_keys) bool _ = my_table->holds(key);
+                for(key_type key: random_keys) bool _ = my_table->holds(key);
+                stop = std::chrono::high_resolution_clock::now();
+                output_data_type query_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+
+                start = std::chrono::high_resolution_clock::now();
+                delete my_table;
+                stop = std::chrono::high_resolution_clock::now();
+                output_data_type destruction_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+                return std::array<output_data_type, 3>{insertion_duration, query_duration, destruction_duration};
+            };
+            std::array<output_data_type, 3> default_durations = time_table(new hash_table(n, seed_multiplier*seed));
+            std::array<output_data_type, 3> arena_durations = time_table(new arena_hash_table(n, seed_multiplier*seed));
+
+            // Saving time and sizes
+            append_to_file(filename, folder_path, {(output_data_type)n,
+                                                   default_durations[0],
+                                                   arena_durations[0],
+                                                   default_durations[1],
+                                                   arena_durations[1],
+                                                   default_durations[2],
+                                                   arena_durations[2]});
+        }
+
+    }
+
+    //// ----------------- Testing Hashing With Chaining on inline buckets ----------------- ////
+    std::cout << " \n-------- Inline Hashing with Chaining --------\n " << std::endl;
+
+    using inline_hash_table = HashingWithChaining<key_type, array_type, InlineBucket<key_type, 8>>;
+    nr_seeds = 500;
+    folder_path = "../../Data/InlineHashingWithChaining";
+    create_folder(folder_path);
+    for(unsigned int seed = 0; seed < nr_seeds; seed++)
+    {
+        std::cout << "Seed iteration nr.: " << seed << std::endl;
+
+        // Timing insertion and query for various n
+        std::string filename = "IHWC_insertion_timing_"+std::to_string(seed_multiplier*seed)+".txt";
+        remove_file(filename,folder_path); // Removing possibly already existing file with name 'filename' from drive.
+        for(key_type w = 5; w <= (key_type)(5+iterations); w++)
+        {
+            // Defining number of keys as power of 2 to enable use of Multiply-Shift hash function
+            key_type n = std::pow(2,w);
+
+            // Generating hash_table and keys
+            inline_hash_table my_inline_hash_table = inline_hash_table(n, seed_multiplier*seed);
+            array_type my_keys = generate_ordered_keys(n);
+
+            // Inserting keys and timing the execution
+            auto start = std::chrono::high_resolution_clock::now();
+            my_inline_hash_table.insert_keys(my_keys);
+            auto stop = std::chrono::high_resolution_clock::now();
+            output_data_type insertion_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+
+            // Getting size of the largest bucket, buckets above 8 keys have spilled
+            unsigned int max_size = my_inline_hash_table.max_bucket_size();
+
+            // Testing query complexity
+            array_type random_keys = generate_random_keys(n,seed_multiplier*seed);
+            start = std::chrono::high_resolution_clock::now();
+            for(key_type key: random_keys) bool _ = my_inline_hash_table.holds(key);
+            stop = std::chrono::high_resolution_clock::now();
+            output_data_type query_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+
+            // Testing batched query complexity
+            std::vector<uint8_t> batch_results(n);
+            start = std::chrono::high_resolution_clock::now();
+            my_inline_hash_table.holds_batch(random_keys, batch_results);
+            stop = std::chrono::high_resolution_clock::now();
+            output_data_type batch_query_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+
+            // Saving time and sizes
+            append_to_file(filename, folder_path, {(output_data_type)n,
+                                                   insertion_duration,
+                                                   (output_data_type)max_size,
+                                                   query_duration,
+                                                   batch_query_duration});
+        }
+
+    }
+
+    //// ----------------- Testing Blocked Bloom Filter in front of the tables ----------------- ////
+    std::cout << " \n-------- Blocked Bloom Filter --------\n " << std::endl;
+
+    using filtered_hash_table = FrontFiltered<key_type, array_type, hash_table>;
+    using filtered_perfect_hashing = FrontFiltered<key_type, array_type, PerfectHashing>;
+    using filtered_red_black_tree = FrontFiltered<key_type, array_type, red_black_tree>;
+    nr_seeds = 500;
+    folder_path = "../../Data/BlockedBloomFilter";
+    create_folder(folder_path);
+    for(unsigned int seed = 0; seed < nr_seeds; seed++)
+    {
+        std::cout << "Seed iteration nr.: " << seed << std::endl;
+
+        // Timing queries with and without the filter in front for various n
+        std::string filename = "BBF_query_timing_"+std::to_string(seed_multiplier*seed)+".txt";
+        remove_file(filename,folder_path); // Removing possibly already existing file with name 'filename' from drive.
+        for(key_type w = 5; w <= (key_type)(5+iterations); w++)
+        {
+            key_type n = std::pow(2,w);
+            array_type my_keys = generate_ordered_keys(n);
+            array_type random_keys = generate_random_keys(n,seed_multiplier*seed);
+
+            // Generating the tables, and the same tables with a filter in front
+            hash_table my_hash_table = hash_table(n, seed_multiplier*seed);
+            my_hash_table.insert_keys(my_keys);
+            PerfectHashing my_perfect_hash_table = PerfectHashing(n, seed_multiplier*seed);
+            my_perfect_hash_table.insert_keys(my_keys, seed_multiplier*seed);
+            red_black_tree my_red_black_tree = red_black_tree();
+            my_red_black_tree.insert_keys(my_keys);
+            filtered_hash_table my_filtered_hash_table = filtered_hash_table(hash_table(my_hash_table), my_keys, seed_multiplier*seed);
+            filtered_perfect_hashing my_filtered_perfect_hash_table = filtered_perfect_hashing(PerfectHashing(my_perfect_hash_table), my_keys, seed_multiplier*seed);
+            filtered_red_black_tree my_filtered_red_black_tree = filtered_red_black_tree(red_black_tree(my_red_black_tree), my_keys, seed_multiplier*seed);
+
+            // False positive rate, i.e. the fraction of absent query keys that pass the filter
+            unsigned int nr_absent = 0, nr_false_positives = 0;
+            for(key_type key : random_keys)
+            {
+                if(my_red_black_tree.holds(key)) continue;
+                nr_absent++;
+                nr_false_positives += my_filtered_hash_table.filter.may_contain(key);
+            }
+            output_data_type false_positive_rate = nr_absent == 0 ? 0 : (output_data_type)nr_false_positives / nr_absent;
+
+            // Hits are counted so that the lookups are not optimized away, and so that a filter that drops a held key is caught.
+            unsigned int nr_hits = 0;
+            auto time_queries = [&](auto& my_table)
+            {
+                unsigned int nr_table_hits = 0;
+                auto start = std::chrono::high_resolution_clock::now();
+                for(key_type key: random_keys) nr_table_hits += my_table.holds(key);
+                auto stop = std::chrono::high_resolution_clock::now();
+                if(nr_hits == 0) nr_hits = nr_table_hits;
+                if(nr_table_hits != nr_hits) throw std::runtime_error("Filtered and unfiltered tables disagree on the query keys.");
+                return (output_data_type)duration_cast<std::chrono::nanoseconds>(stop - start).count();
+            };
+
+            // Saving time and sizes
+            append_to_file(filename, folder_path, {(output_data_type)n,
+                                                   false_positive_rate,
+                                                   (output_data_type)my_filtered_hash_table.filter.size_in_bytes() / n,
+                                                   time_queries(my_hash_table),
+                                                   time_queries(my_filtered_hash_table),
+                                                   time_queries(my_perfect_hash_table),
+                                                   time_queries(my_filtered_perfect_hash_table),
+                                                   time_queries(my_red_black_tree),
+                                                   time_queries(my_filtered_red_black_tree)});
+        }
+
+    }
+
+    //// ----------------- Testing Counting Quotient Filter ----------------- ////
+    std::cout << " \n-------- Counting Quotient Filter --------\n " << std::endl;
+
+    using counting_quotient_filter = CountingQuotientFilter<key_type, array_type>;
+    using blocked_bloom_filter = BlockedBloomFilter<key_type, array_type>;
+    const unsigned int cqf_remainder_bits = 10;
+    nr_seeds = 500;
+    folder_path = "../../Data/CountingQuotientFilter";
+    create_folder(folder_path);
+    for(unsigned int seed = 0; seed < nr_seeds; seed++)
+    {
+        std::cout << "Seed iteration nr.: " << seed << std::endl;
+
+        // Timing inserts, queries and removals of the counting quotient filter against the blocked Bloom filter for various n
+        std::string filename = "CQF_timing_"+std::to_string(seed_multiplier*seed)+".txt";
+        remove_file(filename,folder_path); // Removing possibly already existing file with name 'filename' from drive.
+        for(key_type w = 5; w <= (key_type)(5+iterations); w++)
+        {
+            // 90% of 2^w keys, so the filter is used at a realistic load. For n = 2^w it would need 2^(w+1)
+            // home slots to stay below its maximum load factor, and be half empty.
+            key_type n = 0.9 * std::pow(2,w);
+            array_type my_keys = generate_ordered_keys(n);
+            array_type random_keys = generate_random_keys(n,seed_multiplier*seed);
+            std::set<key_type> key_set(my_keys.begin(), my_keys.end());
+
+            // Inserting the keys
+            counting_quotient_filter my_quotient_filter = counting_quotient_filter(n, seed_multiplier*seed, cqf_remainder_bits);
+            auto start = std::chrono::high_resolution_clock::now();
+            for(key_type key: my_keys) my_quotient_filter.insert(key);
+            auto stop = std::chrono::high_resolution_clock::now();
+            auto cqf_insert_duration = duration_cast<std::chrono::nanoseconds>(stop - start);
+
+            blocked_bloom_filter my_bloom_filter = blocked_bloom_filter(n, seed_multiplier*seed);
+            start = std::chrono::high_resolution_clock::now();
+            for(key_type key: my_keys) my_bloom_filter.insert(key);
+            stop = std::chrono::high_resolution_clock::now();
+            auto bbf_insert_duration = duration_cast<std::chrono::nanoseconds>(stop - start);
+
+            // Querying mostly absent keys, the positives among them being false positives
+            unsigned int nr_absent = 0, nr_cqf_positives = 0, nr_bbf_positives = 0;
+            start = std::chrono::high_resolution_clock::now();
+            for(key_type key: random_keys) nr_cqf_positives += my_quotient_filter.may_contain(key);
+            stop = std::chrono::high_resolution_clock::now();
+            auto cqf_query_duration = duration_cast<std::chrono::nanoseconds>(stop - start);
+
+            start = std::chrono::high_resolution_clock::now();
+            for(key_type key: random_keys) nr_bbf_positives += my_bloom_filter.may_contain(key);
+            stop = std::chrono::high_resolution_clock::now();
+            auto bbf_query_duration = duration_cast<std::chrono::nanoseconds>(stop - start);
+
+            for(key_type key: random_keys)
+            {
+                if(key_set.contains(key))
+                {
+                    nr_cqf_positives--;
+                    nr_bbf_positives--;
+                }
+                else nr_absent++;
+            }
+            output_data_type cqf_false_positive_rate = nr_absent == 0 ? 0 : (output_data_type)nr_cqf_positives / nr_absent;
+            output_data_type bbf_false_positive_rate = nr_absent == 0 ? 0 : (output_data_type)nr_bbf_positives / nr_absent;
+            output_data_type cqf_load_factor = my_quotient_filter.load_factor();
+            output_data_type cqf_bits_per_key = (output_data_type)CHAR_BIT * my_quotient_filter.size_in_bytes() / n;
+            output_data_type bbf_bits_per_key = (output_data_type)CHAR_BIT * my_bloom_filter.size_in_bytes() / n;
+
+            // Removing every other key, which the Bloom filter cannot do
+            start = std::chrono::high_resolution_clock::now();
+            for(key_type i = 0; i < n; i += 2) my_quotient_filter.remove(my_keys[i]);
+            stop = std::chrono::high_resolution_clock::now();
+            auto cqf_remove_duration = duration_cast<std::chrono::nanoseconds>(stop - start);
+            for(key_type i = 1; i < n; i += 2)
+            {
+                if(!my_quotient_filter.may_contain(my_keys[i])) throw std::runtime_error("Counting quotient filter lost a key that was not removed.");
+            }
+
+            // Saving time, false positive rates and sizes
+            append_to_file(filename, folder_path, {(output_data_type)n,
+                                                   cqf_load_factor,
+                                                   cqf_false_positive_rate,
+                                                   cqf_bits_per_key,
+                                                   (output_data_type)cqf_insert_duration.count(),
+                                                   (output_data_type)cqf_query_duration.count(),
+                                                   (output_data_type)cqf_remove_duration.count(),
+                                                   bbf_false_positive_rate,
+                                                   bbf_bits_per_key,
+                                                   (output_data_type)bbf_insert_duration.count(),
+                                                   (output_data_type)bbf_query_duration.count()});
+        }
+
+    }
+
+    //// ----------------- Testing XOR Filter ----------------- ////
+    std::cout << " \n-------- XOR Filter --------\n " << std::endl;
+
+    using xor_filter_8 = XorFilter<key_type, array_type, uint8_t>;
+    using xor_filter_16 = XorFilter<key_type, array_type, uint16_t>;
+    nr_seeds = 500;
+    folder_path = "../../Data/XorFilter";
+    create_folder(folder_path);
+    for(unsigned int seed = 0; seed < nr_seeds; seed++)
+    {
+        std::cout << "Seed iteration nr.: " << seed << std::endl;
+
+        // Bits per key, false positive rate and query time of the XOR filters against the Bloom filter and the exact static tables for various n
+        std::string filename = "XF_query_timing_"+std::to_string(seed_multiplier*seed)+".txt";
+        remove_file(filename,folder_path); // Removing possibly already existing file with name 'filename' from drive.
+        for(key_type w = 5; w <= (key_type)(5+iterations); w++)
+        {
+            key_type n = std::pow(2,w);
+            array_type my_keys = generate_ordered_keys(n);
+            array_type random_keys = generate_random_keys(n,seed_multiplier*seed);
+            std::set<key_type> key_set(my_keys.begin(), my_keys.end());
+
+            // Generating the filters and the exact tables over the same keys
+            xor_filter_8 my_xor_filter_8 = xor_filter_8(n, seed_multiplier*seed);
+            my_xor_filter_8.insert_keys(my_keys);
+            xor_filter_16 my_xor_filter_16 = xor_filter_16(n, seed_multiplier*seed);
+            my_xor_filter_16.insert_keys(my_keys);
+            BlockedBloomFilter<key_type, array_type> my_bloom_filter = BlockedBloomFilter<key_type, array_type>(n, seed_multiplier*seed);
+            my_bloom_filter.insert_keys(my_keys);
+            PerfectHashing my_perfect_hash_table = PerfectHashing(n, seed_multiplier*seed);
+            my_perfect_hash_table.insert_keys(my_keys, seed_multiplier*seed);
+            flat_perfect_hashing my_flat_perfect_hash_table = flat_perfect_hashing(n, seed_multiplier*seed);
+            my_flat_perfect_hash_table.insert_keys(my_keys, seed_multiplier*seed);
+
+            unsigned int nr_absent = 0;
+            for(key_type key: random_keys) nr_absent += !key_set.contains(key);
+            const unsigned int nr_present = random_keys.size() - nr_absent;
+
+            // Times the queries, and returns the false positive rate, i.e. the share of absent query keys reported present.
+            auto time_queries = [&](auto query, output_data_type& false_positive_rate)
+            {
+                unsigned int nr_positives = 0;
+                auto start = std::chrono::high_resolution_clock::now();
+                for(key_type key: random_keys) nr_positives += query(key);
+                auto stop = std::chrono::high_resolution_clock::now();
+                false_positive_rate = nr_absent == 0 ? 0 : (output_data_type)(nr_positives - nr_present) / nr_absent;
+                return (output_data_type)duration_cast<std::chrono::nanoseconds>(stop - start).count();
+            };
+            output_data_type xor_8_false_positive_rate, xor_16_false_positive_rate, bloom_false_positive_rate, exact_false_positive_rate;
+            output_data_type xor_8_time = time_queries([&](key_type key) { return my_xor_filter_8.may_contain(key); }, xor_8_false_positive_rate);
+            output_data_type xor_16_time = time_queries([&](key_type key) { return my_xor_filter_16.may_contain(key); }, xor_16_false_positive_rate);
+            output_data_type bloom_time = time_queries([&](key_type key) { return my_bloom_filter.may_contain(key); }, bloom_false_positive_rate);
+            output_data_type perfect_hashing_time = time_queries([&](key_type key) { return my_perfect_hash_table.holds(key); }, exact_false_positive_rate);
+            output_data_type flat_perfect_hashing_time = time_queries([&](key_type key) { return my_flat_perfect_hash_table.holds(key); }, exact_false_positive_rate);
+
+            // Saving bits per key, false positive rates and time
+            append_to_file(filename, folder_path, {(output_data_type)n,
+                                                   (output_data_type)CHAR_BIT * my_xor_filter_8.size_in_bytes() / n,
+                                                   xor_8_false_positive_rate,
+                                                   xor_8_time,
+                                                   (output_data_type)CHAR_BIT * my_xor_filter_16.size_in_bytes() / n,
+                                                   xor_16_false_positive_rate,
+                                                   xor_16_time,
+                                                   (output_data_type)CHAR_BIT * my_bloom_filter.size_in_bytes() / n,
+                                                   bloom_false_positive_rate,
+                                                   bloom_time,
+                                                   (output_data_type)CHAR_BIT * my_perfect_hash_table.size_in_bytes() / n,
+                                                   perfect_hashing_time,
+                                                   (output_data_type)CHAR_BIT * my_flat_perfect_hash_table.size_in_bytes() / n,
+                                                   flat_perfect_hashing_time});
+        }
+
+    }
+
+    //// ----------------- Testing static ordered sets: Eytzinger layout and S-tree ----------------- ////
+    std::cout << " \n-------- Eytzinger Set and S-Tree --------\n " << std::endl;
+
+    using eytzinger_set = EytzingerSet<key_type, array_type>;
+    using s_tree = STree<key_type, array_type>;
+    const unsigned int range_length = 16;
+    nr_seeds = 500;
+    folder_path = "../../Data/StaticOrderedSet";
+    create_folder(folder_path);
+    for(unsigned int seed = 0; seed < nr_seeds; seed++)
+    {
+        std::cout << "Seed iteration nr.: " << seed << std::endl;
+
+        // Timing construction, membership queries, lower bounds, short range scans and full scans against the red-black tree for various n
+        std::string filename = "SOS_timing_"+std::to_string(seed_multiplier*seed)+".txt";
+        remove_file(filename,folder_path); // Removing possibly already existing file with name 'filename' from drive.
+        for(key_type w = 5; w <= (key_type)(5+iterations); w++)
+        {
+            key_type n = std::pow(2,w);
+            array_type my_keys = generate_ordered_keys(n);
+            // Multiples of 100 (as the keys are) within twice the key range, so about half of the queries hit.
+            array_type random_keys = generate_random_keys(n,seed_multiplier*seed);
+            for(key_type& key: random_keys) key = 100 * (key % (2 * n));
+
+            red_black_tree my_red_black_tree = red_black_tree();
+            eytzinger_set my_eytzinger_set = eytzinger_set();
+            s_tree my_s_tree = s_tree();
+            std::vector<output_data_type> results = {(output_data_type)n};
+
+            // Timing every set, the red-black tree's sum of all keys found being the reference
+            uint64_t expected_checksum = time_ordered_set(my_red_black_tree, my_keys, random_keys, range_length, results);
+            if(time_ordered_set(my_eytzinger_set, my_keys, random_keys, range_length, results) != expected_checksum
+               || time_ordered_set(my_s_tree, my_keys, random_keys, range_length, results) != expected_checksum)
+            {
+                throw std::runtime_error("Static ordered sets disagree with the red-black tree.");
+            }
+
+            // Saving time and sizes
+            append_to_file(filename, folder_path, results);
+        }
+
+    }
+
+    //// ----------------- Testing Bitmap Universe Set ----------------- ////
+    std::cout << " \n-------- Bitmap Universe Set --------\n " << std::endl;
+
+    using bitmap_universe_set = BitmapUniverseSet<key_type, array_type>;
+    nr_seeds = 500;
+    folder_path = "../../Data/BitmapUniverseSet";
+    create_folder(folder_path);
+    for(unsigned int seed = 0; seed < nr_seeds; seed++)
+    {
+        std::cout << "Seed iteration nr.: " << seed << std::endl;
+
+        // Timing construction, membership queries, lower bounds, short range scans and full scans against the red-black tree and the S-tree for various n
+        std::string filename = "BUS_timing_"+std::to_string(seed_multiplier*seed)+".txt";
+        remove_file(filename,folder_path); // Removing possibly already existing file with name 'filename' from drive.
+        for(key_type w = 5; w <= (key_type)(5+iterations); w++)
+        {
+            key_type n = std::pow(2,w);
+            array_type my_keys = generate_ordered_keys(n);
+            // Queries within twice the key range, so about half of them hit.
+            array_type random_keys = generate_random_keys(n,seed_multiplier*seed);
+            for(key_type& key: random_keys) key = 100 * (key % (2 * n));
+
+            red_black_tree my_red_black_tree = red_black_tree();
+            s_tree my_s_tree = s_tree();
+            bitmap_universe_set my_bitmap_universe_set = bitmap_universe_set();
+            std::vector<output_data_type> results = {(output_data_type)n};
+
+            // Timing every set, the red-black tree's sum of all keys found being the reference
+            uint64_t expected_checksum = time_ordered_set(my_red_black_tree, my_keys, random_keys, range_length, results);
+            if(time_ordered_set(my_s_tree, my_keys, random_keys, range_length, results) != expected_checksum
+               || time_ordered_set(my_bitmap_universe_set, my_keys, random_keys, range_length, results) != expected_checksum)
+            {
+                throw std::runtime_error("Bitmap universe set disagrees with the red-black tree.");
+            }
+
+            // Timing predecessor queries, with std::set as the step back from its lower bound
+            uint64_t red_black_tree_checksum = 0, bitmap_universe_set_checksum = 0;
+            auto start = std::chrono::high_resolution_clock::now();
+            for(key_type key: random_keys)
+            {
+                auto iterator = my_red_black_tree.lower_bound(key);
+                if(iterator != my_red_black_tree.begin()) red_black_tree_checksum += *std::prev(iterator);
+            }
+            auto stop = std::chrono::high_resolution_clock::now();
+            results.push_back(duration_cast<std::chrono::nanoseconds>(stop - start).count());
+
+            start = std::chrono::high_resolution_clock::now();
+            for(key_type key: random_keys)
+            {
+                std::optional<key_type> predecessor = my_bitmap_universe_set.predecessor(key);
+                if(predecessor) bitmap_universe_set_checksum += *predecessor;
+            }
+            stop = std::chrono::high_resolution_clock::now();
+            results.push_back(duration_cast<std::chrono::nanoseconds>(stop - start).count());
+            if(red_black_tree_checksum != bitmap_universe_set_checksum) throw std::runtime_error("Bitmap universe set predecessors disagree with the red-black tree.");
+
+            // Saving time and sizes
+            append_to_file(filename, folder_path, results);
+        }
+
+    }
+
+    //// ----------------- Testing Minimal Perfect Hashing ----------------- ////
+    std::cout << " \n-------- Minimal Perfect Hashing --------\n " << std::endl;
+
+    using minimal_perfect_hashing = MinimalPerfectHashing<key_type, array_type>;
+    nr_seeds = 500;
+    folder_path = "../../Data/MinimalPerfectHashing";
+    create_folder(folder_path);
+    for(unsigned int seed = 0; seed < nr_seeds; seed++)
+    {
+        std::cout << "Seed iteration nr.: " << seed << std::endl;
+
+        // Timing single- and multi-threaded construction, bits per key and lookups against the perfect hash table for various n
+        std::string filename = "MPHF_timing_"+std::to_string(seed_multiplier*seed)+".txt";
+        remove_file(filename,folder_path); // Removing possibly already existing file with name 'filename' from drive.
+        for(key_type w = 5; w <= (key_type)(5+iterations); w++)
+        {
+            key_type n = std::pow(2,w);
+            array_type my_keys = generate_ordered_keys(n);
+            array_type query_keys = my_keys;
+            std::shuffle(query_keys.begin(), query_keys.end(), std::mt19937(seed_multiplier*seed));
+
+            // Single-threaded construction
+            minimal_perfect_hashing my_serial_function = minimal_perfect_hashing(n, seed_multiplier*seed);
+            auto start = std::chrono::high_resolution_clock::now();
+            my_serial_function.insert_keys(my_keys, 1);
+            auto stop = std::chrono::high_resolution_clock::now();
+            output_data_type serial_insertion_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+
+            // Multi-threaded construction
+            minimal_perfect_hashing my_minimal_perfect_function = minimal_perfect_hashing(n, seed_multiplier*seed);
+            start = std::chrono::high_resolution_clock::now();
+            my_minimal_perfect_function.insert_keys(my_keys, nr_threads);
+            stop = std::chrono::high_resolution_clock::now();
+            output_data_type parallel_insertion_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+
+            // Lookups of all keys, which must hit every index in [0, n) once
+            std::vector<bool> index_taken(n, false);
+            start = std::chrono::high_resolution_clock::now();
+            for(key_type key: query_keys) index_taken[my_minimal_perfect_function.index_of(key)] = true;
+            stop = std::chrono::high_resolution_clock::now();
+            output_data_type lookup_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+            if(std::find(index_taken.begin(), index_taken.end(), false) != index_taken.end()) throw std::runtime_error("Minimal perfect hash function is not a bijection onto [0, n).");
+
+            // The perfect hash table over the same keys
+            PerfectHashing my_perfect_hash_table = PerfectHashing(n, seed_multiplier*seed);
+            start = std::chrono::high_resolution_clock::now();
+            my_perfect_hash_table.insert_keys(my_keys, seed_multiplier*seed);
+            stop = std::chrono::high_resolution_clock::now();
+            output_data_type perfect_hashing_insertion_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+
+            unsigned int nr_hits = 0;
+            start = std::chrono::high_resolution_clock::now();
+            for(key_type key: query_keys) nr_hits += my_perfect_hash_table.holds(key);
+            stop = std::chrono::high_resolution_clock::now();
+            output_data_type perfect_hashing_lookup_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+            if(nr_hits != n) throw std::runtime_error("Perfect hash table misses some of its keys.");
+
+            // Saving time and bits per key
+            append_to_file(filename, folder_path, {(output_data_type)n,
+                                                   serial_insertion_duration,
+                                                   parallel_insertion_duration,
+                                                   (output_data_type)nr_threads,
+                                                   (output_data_type)CHAR_BIT * my_minimal_perfect_function.size_in_bytes() / n,
+                                                   lookup_duration,
+                                                   perfect_hashing_insertion_duration,
+                                                   (output_data_type)CHAR_BIT * my_perfect_hash_table.size_in_bytes() / n,
+                                                   perfect_hashing_lookup_duration});
+        }
+
+    }
+
+    //// ----------------- Testing Learned Index ----------------- ////
+    std::cout << " \n-------- Learned Index --------\n " << std::endl;
+
+    using learned_index = LearnedIndex<key_type, array_type>;
+    nr_seeds = 500;
+    folder_path = "../../Data/LearnedIndex";
+    create_folder(folder_path);
+    for(unsigned int seed = 0; seed < nr_seeds; seed++)
+    {
+        std::cout << "Seed iteration nr.: " << seed << std::endl;
+
+        // Timing construction and membership queries against std::set and binary search of the sorted keys for various n
+        std::string filename = "LI_timing_"+std::to_string(seed_multiplier*seed)+".txt";
+        remove_file(filename,folder_path); // Removing possibly already existing file with name 'filename' from drive.
+        for(key_type w = 5; w <= (key_type)(5+iterations); w++)
+        {
+            key_type n = std::pow(2,w);
+            array_type my_keys = generate_ordered_keys(n);
+            // Queries within twice the key range, so about half of them hit.
+            array_type random_keys = generate_random_keys(n,seed_multiplier*seed);
+            for(key_type& key: random_keys) key = 100 * (key % (2 * n));
+
+            // Generating the red-black tree (std::set), the sorted array and the learned index over the same keys
+            red_black_tree my_red_black_tree = red_black_tree();
+            auto start = std::chrono::high_resolution_clock::now();
+            my_red_black_tree.insert_keys(my_keys);
+            auto stop = std::chrono::high_resolution_clock::now();
+            output_data_type red_black_tree_insertion_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+
+            start = std::chrono::high_resolution_clock::now();
+            array_type my_sorted_keys = my_keys;
+            std::sort(my_sorted_keys.begin(), my_sorted_keys.end());
+            stop = std::chrono::high_resolution_clock::now();
+            output_data_type sorted_array_insertion_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+
+            learned_index my_learned_index = learned_index();
+            start = std::chrono::high_resolution_clock::now();
+            my_learned_index.insert_keys(my_keys);
+            stop = std::chrono::high_resolution_clock::now();
+            output_data_type learned_index_insertion_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+
+            // Timing the queries, counting hits so that they are not optimized away
+            unsigned int red_black_tree_hits = 0, sorted_array_hits = 0, learned_index_hits = 0;
+            start = std::chrono::high_resolution_clock::now();
+            for(key_type key: random_keys) red_black_tree_hits += my_red_black_tree.holds(key);
+            stop = std::chrono::high_resolution_clock::now();
+            output_data_type red_black_tree_query_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+
+            start = std::chrono::high_resolution_clock::now();
+            for(key_type key: random_keys) sorted_array_hits += std::binary_search(my_sorted_keys.begin(), my_sorted_keys.end(), key);
+            stop = std::chrono::high_resolution_clock::now();
+            output_data_type sorted_array_query_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+
+            start = std::chrono::high_resolution_clock::now();
+            for(key_type key: random_keys) learned_index_hits += my_learned_index.holds(key);
+            stop = std::chrono::high_resolution_clock::now();
+            output_data_type learned_index_query_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+            if(learned_index_hits != red_black_tree_hits || sorted_array_hits != red_black_tree_hits) throw std::runtime_error("Learned index disagrees with the red-black tree.");
+
+            // Saving time and sizes
+            append_to_file(filename, folder_path, {(output_data_type)n,
+                                                   red_black_tree_insertion_duration,
+                                                   red_black_tree_query_duration,
+                                                   sorted_array_insertion_duration,
+                                                   sorted_array_query_duration,
+                                                   learned_index_insertion_duration,
+                                                   learned_index_query_duration,
+                                                   (output_data_type)my_learned_index.model_size_in_bytes(),
+                                                   (output_data_type)my_learned_index.size_in_bytes() / n});
+        }
+
+    }
+
+    //// ----------------- Testing Elias-Fano Set ----------------- ////
+    std::cout << " \n-------- Elias-Fano Set --------\n " << std::endl;
+
+    using elias_fano_set = EliasFanoSet<key_type, array_type>;
+    nr_seeds = 500;
+    folder_path = "../../Data/EliasFanoSet";
+    create_folder(folder_path);
+    for(unsigned int seed = 0; seed < nr_seeds; seed++)
+    {
+        std::cout << "Seed iteration nr.: " << seed << std::endl;
+
+        // Timing construction, membership queries, lower bounds, short range scans and decoding all keys against the red-black tree for various n
+        std::string filename = "EF_timing_"+std::to_string(seed_multiplier*seed)+".txt";
+        remove_file(filename,folder_path); // Removing possibly already existing file with name 'filename' from drive.
+        for(key_type w = 5; w <= (key_type)(5+iterations); w++)
+        {
+            key_type n = std::pow(2,w);
+            array_type my_keys = generate_ordered_keys(n);
+            // Queries within twice the key range, so about half of them hit.
+            array_type random_keys = generate_random_keys(n,seed_multiplier*seed);
+            for(key_type& key: random_keys) key = 100 * (key % (2 * n));
+
+            red_black_tree my_red_black_tree = red_black_tree();
+            elias_fano_set my_elias_fano_set = elias_fano_set();
+            std::vector<output_data_type> results = {(output_data_type)n};
+
+            // Timing both sets, the red-black tree's sum of all keys found being the reference
+            uint64_t expected_checksum = time_ordered_set(my_red_black_tree, my_keys, random_keys, range_length, results);
+            if(time_ordered_set(my_elias_fano_set, my_keys, random_keys, range_length, results) != expected_checksum)
+            {
+                throw std::runtime_error("Elias-Fano set disagrees with the red-black tree.");
+            }
+
+            // Saving time and sizes
+            append_to_file(filename, folder_path, results);
+        }
+
+    }
+
+    //// ----------------- Testing Compact Hashing with Chaining ----------------- ////
+    std::cout << " \n-------- Compact Hashing with Chaining --------\n " << std::endl;
+
+    using compact_hash_table = CompactHashingWithChaining<key_type, array_type>;
+    nr_seeds = 500;
+    folder_path = "../../Data/CompactHashingWithChaining";
+    create_folder(folder_path);
+    for(unsigned int seed = 0; seed < nr_seeds; seed++)
+    {
+        std::cout << "Seed iteration nr.: " << seed << std::endl;
+
+        // Timing construction and membership queries, and bits per key, against hashing with chaining for various n
+        std::string filename = "CompHWC_timing_"+std::to_string(seed_multiplier*seed)+".txt";
+        remove_file(filename,folder_path); // Removing possibly already existing file with name 'filename' from drive.
+        for(key_type w = 5; w <= (key_type)(5+iterations); w++)
+        {
+            key_type n = std::pow(2,w);
+            array_type my_keys = generate_ordered_keys(n);
+            // Queries within twice the key range, so about half of them hit.
+            array_type random_keys = generate_random_keys(n,seed_multiplier*seed);
+            for(key_type& key: random_keys) key = 100 * (key % (2 * n));
+
+            // Generating both tables with the same hash function
+            hash_table my_hash_table = hash_table(n, seed_multiplier*seed);
+            auto start = std::chrono::high_resolution_clock::now();
+            my_hash_table.insert_keys(my_keys);
+            auto stop = std::chrono::high_resolution_clock::now();
+            output_data_type insertion_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+
+            compact_hash_table my_compact_hash_table = compact_hash_table(n, seed_multiplier*seed);
+            start = std::chrono::high_resolution_clock::now();
+            my_compact_hash_table.insert_keys(my_keys);
+            stop = std::chrono::high_resolution_clock::now();
+            output_data_type compact_insertion_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+
+            // Timing the queries, counting hits so that they are not optimized away
+            unsigned int nr_hits = 0, compact_nr_hits = 0;
+            start = std::chrono::high_resolution_clock::now();
+            for(key_type key: random_keys) nr_hits += my_hash_table.holds(key);
+            stop = std::chrono::high_resolution_clock::now();
+            output_data_type query_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+
+            start = std::chrono::high_resolution_clock::now();
+            for(key_type key: random_keys) compact_nr_hits += my_compact_hash_table.holds(key);
+            stop = std::chrono::high_resolution_clock::now();
+            output_data_type compact_query_duration = duration_cast<std::chrono::nanoseconds>(stop - start).count();
+            if(compact_nr_hits != nr_hits) throw std::runtime_error("Compact hashing with chaining disagrees with hashing with chaining.");
+
+            // Saving time, bits stored per key (the full key vs. its remainder) and bits per key in total
+            append_to_file(filename, folder_path, {(output_data_type)n,
+                                                   insertion_duration,
+                                                   query_duration,
+                                                   (output_data_type)KEY_BIT_SIZE,
+                                                   compact_insertion_duration,
+                                                   compact_query_duration,
+                                                   (output_data_type)my_compact_hash_table.remainder_bit_size(),
+                                                   (output_data_type)CHAR_BIT * my_compact_hash_table.size_in_bytes() / n});
+        }
+
+    }
+
+    //// ----------------- Testing Two-Choice Hashing with Chaining ----------------- ////
+    std::cout << " \n-------- Two-Choice Hashing with Chaining --------\n " << std::endl;
+
+    using two_choice_hash_table = TwoChoiceHashingWithChaining<key_type, array_type, linked_list_type>;
+    nr_seeds = 500;
+    folder_path = "../../Data/TwoChoiceHashingWithChaining";
+    create_folder(folder_path);
+    for(unsigned int seed = 0; seed < nr_seeds; seed++)
+    {
+        std::cout << "Seed iteration nr.: " << seed << std::endl;
+
+        // Timing construction, longest chain, and mean and p99 query latency against hashing with chaining for various n
+        std::string filename = "TCHWC_timing_"+std::to_string(seed_multiplier*seed)+".txt";
+        remove_file(filename,folder_path); // Removing possibly already existing file with name 'filename' from drive.
+        for(key_type w = 5; w <= (key_type)(5+iterations); w++)
+        {
+            key_type n = std::pow(2,w);
+            // Random keys, as the regular ordered keys give a single multiply-shift hash unusually even chains.
+            array_type my_keys = generate_random_keys(n,seed_multiplier*seed+1);
+            // Every other query is a stored key, so about half of them hit.
+            array_type random_keys = generate_random_keys(n,seed_multiplier*seed);
+            for(key_type i = 0; i < n; i += 2) random_keys[i] = my_keys[random_keys[i] % n];
+
+            hash_table my_hash_table = hash_table(n, seed_multiplier*seed);
+            two_choice_hash_table my_two_choice_hash_table = two_choice_hash_table(n, seed_multiplier*seed);
+            std::vector<output_data_type> results = {(output_data_type)n};
+
+            // Timing both tables, which must find the same keys
+            uint64_t expected_nr_hits = time_chaining_table(my_hash_table, my_keys, random_keys, results);
+            if(time_chaining_table(my_two_choice_hash_table, my_keys, random_keys, results) != expected_nr_hits)
+            {
+                throw std::runtime_error("Two-choice hashing with chaining disagrees with hashing with chaining.");
+            }
+
+            // Saving time and sizes
+            append_to_file(filename, folder_path, results);
         }
 
     }
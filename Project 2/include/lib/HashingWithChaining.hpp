@@ -3,6 +3,7 @@
 //
 
 #include "Utilities.hpp"
+#include "ArenaAllocator.hpp"
 
 
 template <typename value_type, typename pair_type, typename list_type, typename hash_return_type, typename... hash_args>
@@ -21,6 +22,11 @@ private:
     hashing_constants my_hash_constants;
     bool empty;
 
+    // With an arena allocator the table owns the arena, and every list gets a copy of an allocator that
+    // only points to it. Declared before the lists, so the arena outlives them.
+    std::shared_ptr<node_arena> arena;
+    typename list_type::allocator_type allocator = allocator_for<typename list_type::allocator_type>(this->arena);
+
     // Equivalent to 2^KEY_BIT_SIZE - 1
     uint32_t multiply_shift_upper_bound = static_cast<uint32_t>(std::pow(2,KEY_BIT_SIZE) - 1);
     value_type mersenne_upper_bound = MERSENNE_PRIME; // TODO: Should this be the same for alle the hash funcs w. multiple constants?
@@ -39,8 +45,7 @@ private:
     void initialize_hash_table()
     {
         hash_table.reserve(this->array_size);    // allocate memory for the array/vector
-        hash_table.resize(this->array_size);        // initialize the array/vector with the given size
-        for(key_type i = 0; i < static_cast<key_type>(this->array_size); i++) hash_table[i] = list_type{}; // Setting lists in array/vector.
+        hash_table.assign(this->array_size, list_type(this->allocator)); // Setting lists in array/vector.
     }
 
     /**
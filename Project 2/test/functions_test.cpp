@@ -2,9 +2,14 @@
 // Created by Sebastian Yde Madsen on 02/04/2023.
 //
 
+#if __has_include(<catch2/catch_all.hpp>)
 #include <catch2/catch_all.hpp>
+#else
+#include <catch2/catch.hpp> // Catch2 v2, a single header.
+#endif
 
 #include "lib/HashingWithChaining.hpp"
+#include "ArenaAllocator.hpp" // Shared with Project 1.
 #include "lib/Utilities.hpp"
 #include "lib/Sketch.hpp"
 
@@ -121,4 +126,31 @@ TEST_CASE("Independent 2 (impl. 1) vs. independent 2 (impl. 2)", "[Hash function
     }
     std::cout << "## ====== Independent 2 (impl. 1) vs. independent 2 (impl. 2) ====== ##" << std::endl;
 
-}
\ No newline at end of file
+}
+
+
+TEST_CASE("Arena allocated chains vs. default allocated chains", "[Allocators]")
+{
+    /// ----------- TESTING HASHING WITH CHAINING ON ARENA ALLOCATED LISTS ----------- ///
+    using arena_linked_list_type = std::list<pair_type, ArenaAllocator<pair_type>>;
+    using default_table_type = HashingWithChaining<value_type, pair_type, linked_list_type, uint32_t, uint32_t, uint32_t, uint32_t>;
+    using arena_table_type = HashingWithChaining<value_type, pair_type, arena_linked_list_type, uint32_t, uint32_t, uint32_t, uint32_t>;
+
+    const uint32_t ARRAY_SIZE = 1024;
+    const int64_t N_UPDATES = 100000;
+    default_table_type default_table = default_table_type(ARRAY_SIZE, 7, multiply_shift_hash);
+    arena_table_type arena_table = arena_table_type(ARRAY_SIZE, 7, multiply_shift_hash);
+
+    for(int64_t update = 1; update <= N_UPDATES; update++)
+    {
+        const auto key = static_cast<key_type>((update * 7919) % 4096);
+        default_table.update(std::make_pair(key, update % 5));
+        arena_table.update(std::make_pair(key, update % 5));
+    }
+    REQUIRE(arena_table.query() == default_table.query());
+    for(key_type key = 0; key < 8192; key++)
+    {
+        REQUIRE(std::get<2>(arena_table.holds(key)) == std::get<2>(default_table.holds(key)));
+    }
+    std::cout << "## ====== ARENA ALLOCATOR TEST SUCCESSFUL ====== ##" << std::endl;
+}
@@ -0,0 +1,177 @@
+#ifndef SHARED_ARENAALLOCATOR_HPP
+#define SHARED_ARENAALLOCATOR_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+#define ARENA_FIRST_CHUNK_BYTE_SIZE 4096
+#define ARENA_MAX_CHUNK_BYTE_SIZE (1 << 20)
+
+
+/*
+ * Memory the copies of one 'ArenaAllocator' allocate from. It is carved from contiguous chunks
+ * with a bump pointer, so nodes allocated one after the other end up next to each other. Freed
+ * blocks are kept in a free list per block size and handed out again, and chunks are only
+ * returned to the system when the arena dies, all at once. Not thread safe.
+ *
+ * Project 1 and Project 2 both use this header, so it only depends on the standard library.
+ */
+class node_arena
+{
+private:
+    struct free_block_type
+    {
+        free_block_type* next;
+    };
+
+    struct size_class_type
+    {
+        std::size_t byte_size;
+        free_block_type* free_blocks;
+    };
+
+    // Attributes
+    std::vector<std::unique_ptr<std::byte[]>> chunks;
+    std::byte* position = nullptr;
+    std::byte* chunk_end = nullptr;
+    std::size_t next_chunk_byte_size = ARENA_FIRST_CHUNK_BYTE_SIZE;
+    std::size_t reserved_byte_size = 0;
+
+    std::vector<size_class_type> size_classes; // A handful at most, node sizes of the containers using the arena.
+
+
+    // Methods
+    static std::size_t block_byte_size(const std::size_t& byte_size, const std::size_t& alignment)
+    {
+        // Every block is big enough to hold a free list link, and a multiple of its alignment so blocks can be packed.
+        const std::size_t block_alignment = std::max(alignment, alignof(free_block_type));
+        return (std::max(byte_size, sizeof(free_block_type)) + block_alignment - 1) / block_alignment * block_alignment;
+    }
+
+    size_class_type& size_class(const std::size_t& byte_size)
+    {
+        for(size_class_type& size_class : this->size_classes)
+        {
+            if(size_class.byte_size == byte_size) return size_class;
+        }
+        this->size_classes.push_back({byte_size, nullptr});
+        return this->size_classes.back();
+    }
+
+    void add_chunk(const std::size_t& min_byte_size)
+    {
+        std::size_t chunk_byte_size = std::max(this->next_chunk_byte_size, min_byte_size);
+        this->chunks.push_back(std::make_unique_for_overwrite<std::byte[]>(chunk_byte_size));
+        this->position = this->chunks.back().get();
+        this->chunk_end = this->position + chunk_byte_size;
+        this->reserved_byte_size += chunk_byte_size;
+        this->next_chunk_byte_size = std::min<std::size_t>(2 * this->next_chunk_byte_size, ARENA_MAX_CHUNK_BYTE_SIZE);
+    }
+
+public:
+
+    // Methods
+    void* allocate(const std::size_t& byte_size, const std::size_t& alignment)
+    {
+        std::size_t block_size = block_byte_size(byte_size, alignment);
+        std::size_t block_alignment = std::max(alignment, alignof(free_block_type));
+        size_class_type& blocks = size_class(block_size);
+        if(blocks.free_blocks != nullptr)
+        {
+            free_block_type* block = blocks.free_blocks;
+            blocks.free_blocks = block->next;
+            return block;
+        }
+
+        // Chunks start at the default new alignment, only stricter alignments need padding in front.
+        std::size_t padding = (block_alignment - (std::uintptr_t)this->position % block_alignment) % block_alignment;
+        if(this->position == nullptr || (std::size_t)(this->chunk_end - this->position) < padding + block_size)
+        {
+            add_chunk(block_size + block_alignment);
+            padding = (block_alignment - (std::uintptr_t)this->position % block_alignment) % block_alignment;
+        }
+        void* block = this->position + padding;
+        this->position += padding + block_size;
+        return block;
+    }
+
+    void deallocate(void* block, const std::size_t& byte_size, const std::size_t& alignment)
+    {
+        size_class_type& blocks = size_class(block_byte_size(byte_size, alignment));
+        blocks.free_blocks = ::new(block) free_block_type{blocks.free_blocks};
+    }
+
+    std::size_t size_in_bytes() const
+    {
+        return this->reserved_byte_size;
+    }
+};
+
+
+/*
+ * Allocator for node based containers, e.g. 'std::list<key_type, ArenaAllocator<key_type>>'. It only
+ * points to a 'node_arena' that someone else owns and that must outlive it, so copies (also rebound
+ * ones, like the list's node allocator) are one pointer each. Tables give all their lists copies of
+ * the allocator 'allocator_for' makes, so that the whole table lives in one arena which the table
+ * owns and frees with it.
+ */
+template <typename value_type_>
+class ArenaAllocator
+{
+public:
+    using value_type = value_type_;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    // Attributes
+    node_arena* arena;
+
+    // Parameterized C-tor
+    explicit ArenaAllocator(node_arena& arena) : arena(&arena) {}
+
+    template <typename other_value_type>
+    ArenaAllocator(const ArenaAllocator<other_value_type>& other) : arena(other.arena) {}
+
+    // Methods
+    value_type* allocate(const std::size_t& n)
+    {
+        return static_cast<value_type*>(this->arena->allocate(n * sizeof(value_type), alignof(value_type)));
+    }
+
+    void deallocate(value_type* pointer, const std::size_t& n)
+    {
+        this->arena->deallocate(pointer, n * sizeof(value_type), alignof(value_type));
+    }
+
+    template <typename other_value_type>
+    bool operator==(const ArenaAllocator<other_value_type>& other) const
+    {
+        return this->arena == other.arena;
+    }
+};
+
+
+template <typename allocator_type>
+allocator_type allocator_for(std::shared_ptr<node_arena>& arena)
+{
+    /*
+     * Allocator for all lists of one table. An 'ArenaAllocator' gets a new arena, which is stored
+     * in 'arena' for the table to own (copies of the table share it, as their lists point to it),
+     * other allocators are default constructed and 'arena' stays empty. The table has to declare
+     * 'arena' before its lists, so that it is destroyed after them.
+     */
+    if constexpr (std::is_constructible_v<allocator_type, node_arena&>)
+    {
+        arena = std::make_shared<node_arena>();
+        return allocator_type(*arena);
+    }
+    else return allocator_type();
+}
+
+#endif //SHARED_ARENAALLOCATOR_HPP